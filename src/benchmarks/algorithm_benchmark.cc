@@ -0,0 +1,75 @@
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+
+#include "../s21_containers.h"
+#include "benchmark.h"
+
+namespace {
+constexpr int kSize = 4000000;
+constexpr int kRepeats = 50;
+
+template <typename T>
+s21::vector<T> Make() {
+  s21::vector<T> result;
+  result.reserve(kSize);
+  unsigned seed = 7;
+  for (int i = 0; i < kSize; ++i) {
+    seed = seed * 1103515245u + 12345u;
+    result.push_back(static_cast<T>(seed >> 12 & 0xFFFF));
+  }
+  return result;
+}
+
+template <typename T>
+void Run(const char *type) {
+  auto items = Make<T>();
+  const T missing = static_cast<T>(-1);
+  std::string name(type);
+  bench::Measure("std::find " + name, [&] {
+    for (int i = 0; i < kRepeats; ++i) {
+      bench::DoNotOptimize(std::find(items.begin(), items.end(), missing));
+    }
+  });
+  bench::Measure("s21::find " + name, [&] {
+    for (int i = 0; i < kRepeats; ++i) {
+      bench::DoNotOptimize(s21::find(items, missing));
+    }
+  });
+  bench::Measure("std::count " + name, [&] {
+    for (int i = 0; i < kRepeats; ++i) {
+      bench::DoNotOptimize(std::count(items.begin(), items.end(), T(5)));
+    }
+  });
+  bench::Measure("s21::count " + name, [&] {
+    for (int i = 0; i < kRepeats; ++i) {
+      bench::DoNotOptimize(s21::count(items, T(5)));
+    }
+  });
+  bench::Measure("std::min_element " + name, [&] {
+    for (int i = 0; i < kRepeats; ++i) {
+      bench::DoNotOptimize(std::min_element(items.begin(), items.end()));
+    }
+  });
+  bench::Measure("s21::min_element " + name, [&] {
+    for (int i = 0; i < kRepeats; ++i) {
+      bench::DoNotOptimize(s21::min_element(items));
+    }
+  });
+  bench::Measure("std::accumulate " + name, [&] {
+    for (int i = 0; i < kRepeats; ++i) {
+      bench::DoNotOptimize(std::accumulate(items.begin(), items.end(),
+                                           s21::simd::SumType<T>(0)));
+    }
+  });
+  bench::Measure("s21::sum " + name, [&] {
+    for (int i = 0; i < kRepeats; ++i) bench::DoNotOptimize(s21::sum(items));
+  });
+}
+}  // namespace
+
+int main() {
+  Run<std::int32_t>("int32 x4M x50");
+  Run<float>("float x4M x50");
+  return 0;
+}
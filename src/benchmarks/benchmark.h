@@ -0,0 +1,27 @@
+#ifndef SRC_BENCHMARKS_BENCHMARK_H_
+#define SRC_BENCHMARKS_BENCHMARK_H_
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+namespace bench {
+// Measure() runs func once and prints the wall time it took in milliseconds
+template <typename Func>
+double Measure(const std::string &name, Func func) {
+  auto start = std::chrono::steady_clock::now();
+  func();
+  auto stop = std::chrono::steady_clock::now();
+  double ms = std::chrono::duration<double, std::milli>(stop - start).count();
+  std::printf("%-48s %10.2f ms\n", name.c_str(), ms);
+  return ms;
+}
+
+// DoNotOptimize() keeps the compiler from discarding a computed value
+template <typename T>
+void DoNotOptimize(T const &value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+}  // namespace bench
+
+#endif  // SRC_BENCHMARKS_BENCHMARK_H_
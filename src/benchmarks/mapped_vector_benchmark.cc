@@ -0,0 +1,48 @@
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "benchmark.h"
+
+namespace {
+constexpr int kInts = 20000000;
+const char *const kPath = "/tmp/s21_mapped_vector_benchmark.bin";
+
+void WriteFile() {
+  s21::mapped_vector<int> file(kPath, s21::open_mode::create);
+  file.reserve(kInts);
+  for (int i = 0; i < kInts; ++i) file.push_back(i);
+}
+
+void ReadIntoVector() {
+  std::ifstream file(kPath, std::ios::binary);
+  s21::vector<int> v;
+  int value;
+  while (file.read(reinterpret_cast<char *>(&value), sizeof(value))) {
+    v.push_back(value);
+  }
+  bench::DoNotOptimize(v.data());
+}
+
+void OpenMapped() {
+  s21::mapped_vector<int> v(kPath);
+  bench::DoNotOptimize(v.data());
+}
+
+void SumMapped() {
+  s21::mapped_vector<int> v(kPath);
+  bench::DoNotOptimize(s21::sum(v));
+}
+}  // namespace
+
+int main() {
+  bench::Measure("s21::mapped_vector<int> create x20M", WriteFile);
+  bench::Measure("s21::vector<int> read element by element x20M",
+                 ReadIntoVector);
+  bench::Measure("s21::mapped_vector<int> open x20M", OpenMapped);
+  bench::Measure("s21::mapped_vector<int> open and sum x20M", SumMapped);
+  std::remove(kPath);
+  return 0;
+}
@@ -0,0 +1,430 @@
+#include <map>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "benchmark.h"
+
+namespace {
+constexpr int kKeys = 1000000;
+constexpr int kScanKeys = 10000000;
+constexpr int kCopyKeys = 5000000;
+
+int RandomKey(unsigned *seed) {
+  *seed = *seed * 1103515245u + 12345u;
+  return static_cast<int>(*seed >> 1);
+}
+
+template <typename Set>
+void InsertSorted() {
+  Set s;
+  for (int i = 0; i < kKeys; ++i) s.insert(i);
+  bench::DoNotOptimize(s.size());
+}
+
+template <typename Set>
+void InsertRandom() {
+  Set s;
+  unsigned seed = 12345;
+  for (int i = 0; i < kKeys; ++i) s.insert(RandomKey(&seed));
+  bench::DoNotOptimize(s.size());
+}
+
+template <typename Map>
+void InsertSortedMap() {
+  Map m;
+  for (int i = 0; i < kKeys; ++i) m[i] = i;
+  bench::DoNotOptimize(m.size());
+}
+
+// GetOrInsert() looks up kKeys / 4 random string keys, past the small string
+// buffer and mostly missing, either with operator[] or with a lookup and an
+// insert on a miss, as operator[] did before it took one descent
+template <typename Map, bool kOneDescent>
+void GetOrInsert(const std::string &name) {
+  std::vector<std::string> keys;
+  unsigned seed = 12345;
+  for (int i = 0; i < kKeys / 4; ++i) {
+    keys.push_back(std::to_string(RandomKey(&seed)) + " is a long key");
+  }
+  bench::Measure(name, [&keys] {
+    Map m;
+    for (const std::string &key : keys) {
+      if constexpr (kOneDescent) {
+        m[key];
+      } else if (!m.contains(key)) {
+        m.insert(key, 0);
+      }
+    }
+    bench::DoNotOptimize(m.size());
+  });
+}
+
+template <typename Set>
+void InsertEraseRandom() {
+  Set s;
+  unsigned seed = 12345;
+  for (int i = 0; i < kKeys; ++i) s.insert(RandomKey(&seed));
+  seed = 12345;
+  for (int i = 0; i < kKeys; ++i) {
+    auto it = s.find(RandomKey(&seed));
+    if (it != s.end()) s.erase(it);
+  }
+  bench::DoNotOptimize(s.size());
+}
+
+// Churn() keeps about kKeys / 4 random keys alive while kKeys keys are
+// inserted and erased
+template <typename Set>
+void Churn() {
+  Set s;
+  unsigned insert_seed = 12345;
+  unsigned erase_seed = 12345;
+  for (int i = 0; i < kKeys; ++i) {
+    s.insert(RandomKey(&insert_seed) % kKeys);
+    if (i >= kKeys / 4) {
+      auto it = s.find(RandomKey(&erase_seed) % kKeys);
+      if (it != s.end()) s.erase(it);
+    }
+  }
+  bench::DoNotOptimize(s.size());
+}
+
+// Teardown() times clear() of a set built from kKeys random keys
+template <typename Set>
+void Teardown(const std::string &name) {
+  Set s;
+  unsigned seed = 12345;
+  for (int i = 0; i < kKeys; ++i) s.insert(RandomKey(&seed));
+  bench::Measure(name, [&s] { s.clear(); });
+}
+
+template <typename Set>
+void FindRandom() {
+  Set s;
+  unsigned seed = 12345;
+  for (int i = 0; i < kKeys; ++i) s.insert(RandomKey(&seed) % kKeys);
+  int found = 0;
+  for (int round = 0; round < 4; ++round) {
+    for (int i = 0; i < kKeys; ++i) found += s.find(i) != s.end();
+  }
+  bench::DoNotOptimize(found);
+}
+
+// FindByView() times lookups of string_view keys, longer than the small
+// string buffer, in a map of 100k strings. Without a transparent comparator
+// (kByView false) every lookup has to build a std::string first
+template <typename Map, bool kByView>
+void FindByView(const std::string &name) {
+  std::vector<std::string> keys;
+  for (int i = 0; i < 100000; ++i) {
+    keys.push_back(std::to_string(i) + " is a reasonably long key");
+  }
+  Map m;
+  for (const std::string &key : keys) m[key] = 1;
+  bench::Measure(name, [&m, &keys] {
+    int found = 0;
+    for (int round = 0; round < 10; ++round) {
+      for (std::string_view key : keys) {
+        if constexpr (kByView) {
+          found += m.find(key) != m.end();
+        } else {
+          found += m.find(std::string(key)) != m.end();
+        }
+      }
+    }
+    bench::DoNotOptimize(found);
+  });
+}
+
+// CopyMap() times copy construction of a map with kCopyKeys random keys
+template <typename Map>
+void CopyMap(const std::string &name) {
+  Map m;
+  unsigned seed = 12345;
+  for (int i = 0; i < kCopyKeys; ++i) m[RandomKey(&seed)] = i;
+  bench::Measure(name, [&m] {
+    Map copy(m);
+    bench::DoNotOptimize(copy.size());
+  });
+}
+
+// BulkLoad() times building a set from a vector of kCopyKeys sorted keys
+// through the range constructor
+template <typename Set>
+void BulkLoad(const std::string &name) {
+  std::vector<int> keys;
+  for (int i = 0; i < kCopyKeys; ++i) keys.push_back(i);
+  bench::Measure(name, [&keys] {
+    Set s(keys.begin(), keys.end());
+    bench::DoNotOptimize(s.size());
+  });
+}
+
+// NearlySorted() times inserting kKeys ascending keys of which every 16th is
+// late by a few places, either plainly or with end() as the hint
+template <typename Set, bool kHinted>
+void NearlySorted(const std::string &name) {
+  std::vector<int> keys;
+  for (int i = 0; i < kKeys; ++i) {
+    keys.push_back(i % 16 == 15 ? 2 * i - 15 : 2 * i);
+  }
+  bench::Measure(name, [&keys] {
+    Set s;
+    for (int key : keys) {
+      if constexpr (kHinted) {
+        s.insert(s.end(), key);
+      } else {
+        s.insert(key);
+      }
+    }
+    bench::DoNotOptimize(s.size());
+  });
+}
+
+// Rekey() times moving every entry of a map of kKeys / 10 strings to a new
+// key, either through a node handle or by erasing and inserting a copy
+template <typename Map, bool kByHandle>
+void Rekey(const std::string &name) {
+  Map m;
+  for (int i = 0; i < kKeys / 10; ++i) {
+    m[i] = std::to_string(i) + " is a value past the small string buffer";
+  }
+  bench::Measure(name, [&m] {
+    for (int round = 1; round <= 10; ++round) {
+      int shift = round * kKeys / 10;
+      for (int i = 0; i < kKeys / 10; ++i) {
+        int key = i + shift - kKeys / 10;
+        if constexpr (kByHandle) {
+          auto handle = m.extract(key);
+          handle.key() = i + shift;
+          m.insert(m.end(), std::move(handle));
+        } else {
+          auto it = m.find(key);
+          std::string value = (*it).second;
+          m.erase(it);
+          m.insert(m.end(), {i + shift, value});
+        }
+      }
+    }
+    bench::DoNotOptimize(m.size());
+  });
+}
+
+// Percentiles() times reading the 1st to 99th percentile of kKeys / 10
+// random samples, by nth() on a ranked multiset or by walking from begin()
+// otherwise
+template <typename Set, bool kRanked>
+void Percentiles(const std::string &name) {
+  Set s;
+  unsigned seed = 12345;
+  for (int i = 0; i < kKeys / 10; ++i) s.insert(RandomKey(&seed));
+  bench::Measure(name, [&s] {
+    long long sum = 0;
+    for (std::size_t p = 1; p < 100; ++p) {
+      std::size_t k = s.size() * p / 100;
+      if constexpr (kRanked) {
+        sum += *s.nth(k);
+      } else {
+        auto it = s.begin();
+        for (std::size_t i = 0; i < k; ++i) ++it;
+        sum += *it;
+      }
+    }
+    bench::DoNotOptimize(sum);
+  });
+}
+
+// TimeWindows() sums 100 windows of about 1000 entries each from a map of
+// kKeys timestamps, either through range() or by scanning from begin() as
+// the only way without bound queries
+template <typename Map, bool kByRange>
+void TimeWindows(const std::string &name) {
+  Map m;
+  for (int i = 0; i < kKeys; ++i) m.insert(10LL * i, i);
+  bench::Measure(name, [&m] {
+    long long sum = 0;
+    for (long long t0 = 0; t0 < 10LL * kKeys; t0 += kKeys / 10) {
+      long long t1 = t0 + 10000;
+      if constexpr (kByRange) {
+        for (const auto &entry : m.range(t0, t1)) sum += entry.second;
+      } else {
+        for (auto it = m.begin(); it != m.end() && (*it).first < t1; ++it) {
+          if ((*it).first >= t0) sum += (*it).second;
+        }
+      }
+    }
+    bench::DoNotOptimize(sum);
+  });
+}
+
+// CountDuplicates() builds a multiset of kKeys keys with 1000 copies of each
+// and times count() of every key
+template <typename Set>
+void CountDuplicates(const std::string &name) {
+  Set s;
+  unsigned seed = 12345;
+  for (int i = 0; i < kKeys; ++i) s.insert(RandomKey(&seed) % 1000);
+  bench::Measure(name, [&s] {
+    std::size_t found = 0;
+    for (int key = 0; key < 1000; ++key) found += s.count(key);
+    bench::DoNotOptimize(found);
+  });
+}
+
+// EventIndex() indexes kKeys events by kKeys / kPerKey timestamps, random or
+// in the order a log produces them, and looks up every timestamp, either in a
+// multimap, inserting at end() when in order, or in a map of vectors, which
+// costs one more allocation per timestamp
+template <typename Index, bool kMultimap, int kPerKey, bool kInOrder>
+void EventIndex(const std::string &name) {
+  bench::Measure(name, [] {
+    Index index;
+    unsigned seed = 12345;
+    for (int i = 0; i < kKeys; ++i) {
+      int timestamp =
+          kInOrder ? i / kPerKey : RandomKey(&seed) % (kKeys / kPerKey);
+      if constexpr (kMultimap && kInOrder) {
+        index.insert(index.end(), {timestamp, i});
+      } else if constexpr (kMultimap) {
+        index.insert({timestamp, i});
+      } else {
+        index[timestamp].push_back(i);
+      }
+    }
+    long long sum = 0;
+    for (int timestamp = 0; timestamp < kKeys / kPerKey; ++timestamp) {
+      if constexpr (kMultimap) {
+        auto events = index.equal_range(timestamp);
+        for (auto it = events.first; it != events.second; ++it) {
+          sum += (*it).second;
+        }
+      } else {
+        auto found = index.find(timestamp);
+        if (found == index.end()) continue;
+        for (int event : (*found).second) sum += event;
+      }
+    }
+    bench::DoNotOptimize(sum);
+  });
+}
+
+// ScanFull() builds a set of kScanKeys sorted keys and times one forward and
+// one backward pass over it
+template <typename Set>
+void ScanFull(const std::string &name) {
+  Set s;
+  for (int i = 0; i < kScanKeys; ++i) s.insert(i);
+  bench::Measure(name, [&s] {
+    long long sum = 0;
+    for (auto it = s.begin(); it != s.end(); ++it) sum += *it;
+    for (auto it = s.end(); it != s.begin();) sum -= *--it;
+    bench::DoNotOptimize(sum);
+  });
+}
+}  // namespace
+
+int main() {
+  bench::Measure("s21::set<int> insert sorted x1M",
+                 InsertSorted<s21::set<int>>);
+  bench::Measure("std::set<int> insert sorted x1M",
+                 InsertSorted<std::set<int>>);
+  bench::Measure("s21::set<int> insert random x1M",
+                 InsertRandom<s21::set<int>>);
+  bench::Measure("std::set<int> insert random x1M",
+                 InsertRandom<std::set<int>>);
+  bench::Measure("s21::multiset<int> insert sorted x1M",
+                 InsertSorted<s21::multiset<int>>);
+  bench::Measure("std::multiset<int> insert sorted x1M",
+                 InsertSorted<std::multiset<int>>);
+  bench::Measure("s21::Map<int, int> operator[] sorted x1M",
+                 InsertSortedMap<s21::Map<int, int>>);
+  bench::Measure("std::map<int, int> operator[] sorted x1M",
+                 InsertSortedMap<std::map<int, int>>);
+  GetOrInsert<s21::Map<std::string, int>, false>(
+      "s21::Map<std::string, int> contains(), insert x250k");
+  GetOrInsert<s21::Map<std::string, int>, true>(
+      "s21::Map<std::string, int> operator[] x250k");
+  GetOrInsert<std::map<std::string, int>, true>(
+      "std::map<std::string, int> operator[] x250k");
+  bench::Measure("s21::set<int> insert and erase random x1M",
+                 InsertEraseRandom<s21::set<int>>);
+  bench::Measure("std::set<int> insert and erase random x1M",
+                 InsertEraseRandom<std::set<int>>);
+  bench::Measure("s21::set<int> churn x1M", Churn<s21::set<int>>);
+  bench::Measure(
+      "s21::set<int, NodePoolAllocator> churn x1M",
+      Churn<s21::set<int, std::less<int>, s21::NodePoolAllocator<int>>>);
+  bench::Measure("std::set<int> churn x1M", Churn<std::set<int>>);
+  bench::Measure("s21::set<int> build and find x4M", FindRandom<s21::set<int>>);
+  bench::Measure("std::set<int> build and find x4M", FindRandom<std::set<int>>);
+  Teardown<s21::set<int>>("s21::set<int> clear random x1M");
+  Teardown<std::set<int>>("std::set<int> clear random x1M");
+  FindByView<s21::Map<std::string, int>, false>(
+      "s21::Map<std::string, int> find by building a key x1M");
+  FindByView<s21::Map<std::string, int, std::less<>>, true>(
+      "s21::Map<std::string, int, std::less<>> find by view x1M");
+  FindByView<std::map<std::string, int, std::less<>>, true>(
+      "std::map<std::string, int, std::less<>> find by view x1M");
+  CopyMap<s21::Map<int, int>>("s21::Map<int, int> copy x5M");
+  CopyMap<std::map<int, int>>("std::map<int, int> copy x5M");
+  BulkLoad<s21::set<int>>("s21::set<int> range constructor sorted x5M");
+  BulkLoad<std::set<int>>("std::set<int> range constructor sorted x5M");
+  NearlySorted<s21::set<int>, false>("s21::set<int> insert nearly sorted x1M");
+  NearlySorted<s21::set<int>, true>(
+      "s21::set<int> insert nearly sorted at end() x1M");
+  NearlySorted<std::set<int>, true>(
+      "std::set<int> insert nearly sorted at end() x1M");
+  NearlySorted<s21::multiset<int>, true>(
+      "s21::multiset<int> nearly sorted at end() x1M");
+  Rekey<s21::Map<int, std::string>, false>(
+      "s21::Map<int, std::string> rekey by erase x1M");
+  Rekey<s21::Map<int, std::string>, true>(
+      "s21::Map<int, std::string> rekey by handle x1M");
+  Rekey<std::map<int, std::string>, true>(
+      "std::map<int, std::string> rekey by handle x1M");
+  bench::Measure("s21::multiset<int> insert random x1M",
+                 InsertRandom<s21::multiset<int>>);
+  bench::Measure("s21::ranked_multiset<int> insert random x1M",
+                 InsertRandom<s21::ranked_multiset<int>>);
+  Percentiles<s21::multiset<int>, false>(
+      "s21::multiset<int> percentiles by walking x99");
+  Percentiles<s21::ranked_multiset<int>, true>(
+      "s21::ranked_multiset<int> percentiles nth() x99");
+  TimeWindows<s21::Map<long long, int>, false>(
+      "s21::Map<long long, int> windows by scan x100");
+  TimeWindows<s21::Map<long long, int>, true>(
+      "s21::Map<long long, int> windows by range() x100");
+  CountDuplicates<s21::multiset<int>>("s21::multiset<int> count x1000 keys");
+  CountDuplicates<s21::ranked_multiset<int>>(
+      "s21::ranked_multiset<int> count x1000 keys");
+  CountDuplicates<s21::run_length_multiset<int>>(
+      "s21::run_length_multiset<int> count x1000 keys");
+  CountDuplicates<std::multiset<int>>("std::multiset<int> count x1000 keys");
+  bench::Measure("s21::run_length_multiset<int> insert random x1M",
+                 InsertRandom<s21::run_length_multiset<int>>);
+  EventIndex<s21::multimap<int, int>, true, 1, false>(
+      "s21::multimap<int, int> event index 1 per key x1M");
+  EventIndex<s21::Map<int, s21::vector<int>>, false, 1, false>(
+      "s21::Map<int, s21::vector<int>> event index 1 per key x1M");
+  EventIndex<std::multimap<int, int>, true, 1, false>(
+      "std::multimap<int, int> event index 1 per key x1M");
+  EventIndex<s21::multimap<int, int>, true, 8, false>(
+      "s21::multimap<int, int> event index 8 per key x1M");
+  EventIndex<s21::Map<int, s21::vector<int>>, false, 8, false>(
+      "s21::Map<int, s21::vector<int>> event index 8 per key x1M");
+  EventIndex<std::multimap<int, int>, true, 8, false>(
+      "std::multimap<int, int> event index 8 per key x1M");
+  EventIndex<s21::multimap<int, int>, true, 8, true>(
+      "s21::multimap<int, int> event index in order x1M");
+  EventIndex<s21::Map<int, s21::vector<int>>, false, 8, true>(
+      "s21::Map<int, s21::vector<int>> event index in order x1M");
+  EventIndex<std::multimap<int, int>, true, 8, true>(
+      "std::multimap<int, int> event index in order x1M");
+  ScanFull<s21::set<int>>("s21::set<int> scan both ways x10M");
+  ScanFull<std::set<int>>("std::set<int> scan both ways x10M");
+  return 0;
+}
@@ -0,0 +1,103 @@
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "benchmark.h"
+
+namespace {
+constexpr int kInts = 10000000;
+constexpr int kStrings = 1000000;
+constexpr int kSmallVectors = 1000000;
+constexpr int kFlags = 100000000;
+
+template <typename Vector>
+void GrowInts() {
+  Vector v;
+  for (int i = 0; i < kInts; ++i) v.push_back(i);
+  bench::DoNotOptimize(v.data());
+}
+
+template <typename Vector>
+void GrowStrings() {
+  Vector v;
+  std::string value(32, 'x');
+  for (int i = 0; i < kStrings; ++i) v.push_back(value);
+  bench::DoNotOptimize(v.data());
+}
+
+template <typename Vector>
+void ReserveStrings() {
+  Vector v;
+  std::string value(32, 'x');
+  for (int i = 0; i < kStrings; ++i) v.push_back(value);
+  for (int i = 0; i < 20; ++i) {
+    v.reserve(v.capacity() + 1);
+    v.shrink_to_fit();
+  }
+  bench::DoNotOptimize(v.data());
+}
+
+template <typename Vector>
+void SortInts() {
+  Vector v;
+  unsigned seed = 12345;
+  for (int i = 0; i < kInts; ++i) {
+    seed = seed * 1103515245u + 12345u;
+    v.push_back(static_cast<int>(seed >> 1));
+  }
+  std::sort(v.begin(), v.end());
+  bench::DoNotOptimize(v.data());
+}
+
+template <typename Vector>
+void ManySmall() {
+  for (int i = 0; i < kSmallVectors; ++i) {
+    Vector v;
+    for (int j = 0; j < 6; ++j) v.push_back(i + j);
+    bench::DoNotOptimize(v.data());
+  }
+}
+
+template <typename Vector>
+void CountFlags() {
+  Vector v;
+  for (int i = 0; i < kFlags; ++i) v.push_back(i % 7 == 0);
+  std::size_t total = 0;
+  for (int i = 0; i < 10; ++i) {
+    if constexpr (std::is_same_v<Vector, s21::vector<bool>>) {
+      total += v.count();
+    } else {
+      total += std::count(v.begin(), v.end(), true);
+    }
+  }
+  bench::DoNotOptimize(total);
+}
+}  // namespace
+
+int main() {
+  bench::Measure("s21::vector<int> push_back x10M", GrowInts<s21::vector<int>>);
+  bench::Measure("std::vector<int> push_back x10M", GrowInts<std::vector<int>>);
+  bench::Measure("s21::vector<string> push_back x1M",
+                 GrowStrings<s21::vector<std::string>>);
+  bench::Measure("std::vector<string> push_back x1M",
+                 GrowStrings<std::vector<std::string>>);
+  bench::Measure("s21::vector<string> reserve/shrink x40",
+                 ReserveStrings<s21::vector<std::string>>);
+  bench::Measure("std::vector<string> reserve/shrink x40",
+                 ReserveStrings<std::vector<std::string>>);
+  bench::Measure("s21::vector<int> std::sort x10M", SortInts<s21::vector<int>>);
+  bench::Measure("std::vector<int> std::sort x10M", SortInts<std::vector<int>>);
+  bench::Measure("s21::vector<int> 6 elements x1M",
+                 ManySmall<s21::vector<int>>);
+  bench::Measure("s21::small_vector<int, 8> 6 elements x1M",
+                 ManySmall<s21::small_vector<int, 8>>);
+  bench::Measure("std::vector<int> 6 elements x1M",
+                 ManySmall<std::vector<int>>);
+  bench::Measure("s21::vector<bool> push_back x100M, count x10",
+                 CountFlags<s21::vector<bool>>);
+  bench::Measure("std::vector<bool> push_back x100M, count x10",
+                 CountFlags<std::vector<bool>>);
+  return 0;
+}
@@ -0,0 +1,473 @@
+#ifndef SRC_S21_ALGORITHM_H_
+#define SRC_S21_ALGORITHM_H_
+
+// The kernels need SSE2 at compile time: always there on x86-64, only with
+// -msse2 or a later -march on 32-bit x86
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__) && \
+    (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define S21_SIMD_X86 1
+#define S21_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+namespace s21 {
+namespace simd {
+// Isa names an instruction set the kernels can run on
+enum class Isa { kScalar, kSse2, kAvx2 };
+
+// BestIsa() returns the widest instruction set the running CPU supports, it
+// is detected once per process
+inline Isa BestIsa() {
+#ifdef S21_SIMD_X86
+  static const Isa isa =
+      __builtin_cpu_supports("avx2") ? Isa::kAvx2 : Isa::kSse2;
+  return isa;
+#else
+  return Isa::kScalar;
+#endif
+}
+
+// HasKernels tells whether T has vectorized kernels, other arithmetic types
+// always run the scalar loops
+template <typename T>
+struct HasKernels
+    : std::bool_constant<std::is_same_v<T, std::int32_t> ||
+                         std::is_same_v<T, float>> {};
+
+// SumType is what sum() accumulates into: 64 bits for integers so that large
+// buffers do not overflow, the element type for floating point
+template <typename T>
+using SumType = std::conditional_t<
+    std::is_floating_point_v<T>, T,
+    std::conditional_t<std::is_signed_v<T>, std::int64_t, std::uint64_t>>;
+
+// Scalar kernels
+
+template <typename T>
+const T *FindScalar(const T *first, const T *last, T value) {
+  for (; first != last; ++first) {
+    if (*first == value) break;
+  }
+  return first;
+}
+
+template <typename T>
+std::size_t CountScalar(const T *first, const T *last, T value) {
+  std::size_t result = 0;
+  for (; first != last; ++first) result += *first == value;
+  return result;
+}
+
+template <typename T>
+SumType<T> SumScalar(const T *first, const T *last) {
+  SumType<T> result = 0;
+  for (; first != last; ++first) result += *first;
+  return result;
+}
+
+#ifdef S21_SIMD_X86
+// SSE2 kernels, compiled whenever the target has SSE2
+
+inline const std::int32_t *FindSse2(const std::int32_t *first,
+                                    const std::int32_t *last,
+                                    std::int32_t value) {
+  const __m128i needle = _mm_set1_epi32(value);
+  for (; last - first >= 4; first += 4) {
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first));
+    int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(block, needle)));
+    if (mask) return first + __builtin_ctz(mask);
+  }
+  return FindScalar(first, last, value);
+}
+
+inline const float *FindSse2(const float *first, const float *last,
+                             float value) {
+  const __m128 needle = _mm_set1_ps(value);
+  for (; last - first >= 4; first += 4) {
+    int mask = _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(first), needle));
+    if (mask) return first + __builtin_ctz(mask);
+  }
+  return FindScalar(first, last, value);
+}
+
+inline std::size_t CountSse2(const std::int32_t *first,
+                             const std::int32_t *last, std::int32_t value) {
+  const __m128i needle = _mm_set1_epi32(value);
+  std::size_t result = 0;
+  for (; last - first >= 4; first += 4) {
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first));
+    result += __builtin_popcount(
+        _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(block, needle))));
+  }
+  return result + CountScalar(first, last, value);
+}
+
+inline std::size_t CountSse2(const float *first, const float *last,
+                             float value) {
+  const __m128 needle = _mm_set1_ps(value);
+  std::size_t result = 0;
+  for (; last - first >= 4; first += 4) {
+    result += __builtin_popcount(
+        _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(first), needle)));
+  }
+  return result + CountScalar(first, last, value);
+}
+
+// SSE2 has no 32-bit integer min/max, so they are built from a compare
+inline __m128i MinSse2(__m128i one, __m128i two) {
+  __m128i greater = _mm_cmpgt_epi32(one, two);
+  return _mm_or_si128(_mm_and_si128(greater, two),
+                      _mm_andnot_si128(greater, one));
+}
+
+inline __m128i MaxSse2(__m128i one, __m128i two) {
+  __m128i greater = _mm_cmpgt_epi32(one, two);
+  return _mm_or_si128(_mm_and_si128(greater, one),
+                      _mm_andnot_si128(greater, two));
+}
+
+// ExtremumSse2() returns the smallest (IsMin) or the largest value of a non
+// empty range
+template <bool IsMin>
+std::int32_t ExtremumSse2(const std::int32_t *first, const std::int32_t *last) {
+  std::int32_t result = *first;
+  if (last - first >= 4) {
+    __m128i best = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first));
+    for (first += 4; last - first >= 4; first += 4) {
+      __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first));
+      best = IsMin ? MinSse2(best, block) : MaxSse2(best, block);
+    }
+    alignas(16) std::int32_t lanes[4];
+    _mm_store_si128(reinterpret_cast<__m128i *>(lanes), best);
+    result = lanes[0];
+    for (std::int32_t lane : lanes) {
+      if (IsMin ? lane < result : lane > result) result = lane;
+    }
+  }
+  for (; first != last; ++first) {
+    if (IsMin ? *first < result : *first > result) result = *first;
+  }
+  return result;
+}
+
+// For floats the kernel also reports whether it met a NaN, the vector min/max
+// instructions do not order NaNs the way std::min_element does
+template <bool IsMin>
+float ExtremumSse2(const float *first, const float *last, bool *has_nan) {
+  float result = *first;
+  __m128 nan = _mm_setzero_ps();
+  if (last - first >= 4) {
+    __m128 best = _mm_loadu_ps(first);
+    nan = _mm_cmpunord_ps(best, best);
+    for (first += 4; last - first >= 4; first += 4) {
+      __m128 block = _mm_loadu_ps(first);
+      nan = _mm_or_ps(nan, _mm_cmpunord_ps(block, block));
+      best = IsMin ? _mm_min_ps(best, block) : _mm_max_ps(best, block);
+    }
+    alignas(16) float lanes[4];
+    _mm_store_ps(lanes, best);
+    result = lanes[0];
+    for (float lane : lanes) {
+      if (IsMin ? lane < result : lane > result) result = lane;
+    }
+  }
+  *has_nan = _mm_movemask_ps(nan) != 0;
+  for (; first != last; ++first) {
+    if (*first != *first) *has_nan = true;
+    if (IsMin ? *first < result : *first > result) result = *first;
+  }
+  return result;
+}
+
+inline std::int64_t SumSse2(const std::int32_t *first,
+                            const std::int32_t *last) {
+  __m128i total = _mm_setzero_si128();
+  for (; last - first >= 4; first += 4) {
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first));
+    __m128i sign = _mm_srai_epi32(block, 31);
+    total = _mm_add_epi64(total, _mm_unpacklo_epi32(block, sign));
+    total = _mm_add_epi64(total, _mm_unpackhi_epi32(block, sign));
+  }
+  alignas(16) std::int64_t lanes[2];
+  _mm_store_si128(reinterpret_cast<__m128i *>(lanes), total);
+  return lanes[0] + lanes[1] + SumScalar(first, last);
+}
+
+inline float SumSse2(const float *first, const float *last) {
+  __m128 total = _mm_setzero_ps();
+  for (; last - first >= 4; first += 4) {
+    total = _mm_add_ps(total, _mm_loadu_ps(first));
+  }
+  alignas(16) float lanes[4];
+  _mm_store_ps(lanes, total);
+  return lanes[0] + lanes[1] + lanes[2] + lanes[3] + SumScalar(first, last);
+}
+
+// AVX2 kernels, only called after BestIsa() has seen AVX2 at run time
+
+S21_TARGET_AVX2 inline const std::int32_t *FindAvx2(const std::int32_t *first,
+                                                    const std::int32_t *last,
+                                                    std::int32_t value) {
+  const __m256i needle = _mm256_set1_epi32(value);
+  for (; last - first >= 8; first += 8) {
+    __m256i block =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(first));
+    int mask = _mm256_movemask_ps(
+        _mm256_castsi256_ps(_mm256_cmpeq_epi32(block, needle)));
+    if (mask) return first + __builtin_ctz(mask);
+  }
+  return FindScalar(first, last, value);
+}
+
+S21_TARGET_AVX2 inline const float *FindAvx2(const float *first,
+                                             const float *last, float value) {
+  const __m256 needle = _mm256_set1_ps(value);
+  for (; last - first >= 8; first += 8) {
+    int mask = _mm256_movemask_ps(
+        _mm256_cmp_ps(_mm256_loadu_ps(first), needle, _CMP_EQ_OQ));
+    if (mask) return first + __builtin_ctz(mask);
+  }
+  return FindScalar(first, last, value);
+}
+
+S21_TARGET_AVX2 inline std::size_t CountAvx2(const std::int32_t *first,
+                                             const std::int32_t *last,
+                                             std::int32_t value) {
+  const __m256i needle = _mm256_set1_epi32(value);
+  std::size_t result = 0;
+  for (; last - first >= 8; first += 8) {
+    __m256i block =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(first));
+    result += __builtin_popcount(_mm256_movemask_ps(
+        _mm256_castsi256_ps(_mm256_cmpeq_epi32(block, needle))));
+  }
+  return result + CountScalar(first, last, value);
+}
+
+S21_TARGET_AVX2 inline std::size_t CountAvx2(const float *first,
+                                             const float *last, float value) {
+  const __m256 needle = _mm256_set1_ps(value);
+  std::size_t result = 0;
+  for (; last - first >= 8; first += 8) {
+    result += __builtin_popcount(_mm256_movemask_ps(
+        _mm256_cmp_ps(_mm256_loadu_ps(first), needle, _CMP_EQ_OQ)));
+  }
+  return result + CountScalar(first, last, value);
+}
+
+template <bool IsMin>
+S21_TARGET_AVX2 std::int32_t ExtremumAvx2(const std::int32_t *first,
+                                          const std::int32_t *last) {
+  std::int32_t result = *first;
+  if (last - first >= 8) {
+    __m256i best = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(first));
+    for (first += 8; last - first >= 8; first += 8) {
+      __m256i block =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i *>(first));
+      best = IsMin ? _mm256_min_epi32(best, block)
+                   : _mm256_max_epi32(best, block);
+    }
+    alignas(32) std::int32_t lanes[8];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), best);
+    result = lanes[0];
+    for (std::int32_t lane : lanes) {
+      if (IsMin ? lane < result : lane > result) result = lane;
+    }
+  }
+  for (; first != last; ++first) {
+    if (IsMin ? *first < result : *first > result) result = *first;
+  }
+  return result;
+}
+
+template <bool IsMin>
+S21_TARGET_AVX2 float ExtremumAvx2(const float *first, const float *last,
+                                   bool *has_nan) {
+  float result = *first;
+  __m256 nan = _mm256_setzero_ps();
+  if (last - first >= 8) {
+    __m256 best = _mm256_loadu_ps(first);
+    nan = _mm256_cmp_ps(best, best, _CMP_UNORD_Q);
+    for (first += 8; last - first >= 8; first += 8) {
+      __m256 block = _mm256_loadu_ps(first);
+      nan = _mm256_or_ps(nan, _mm256_cmp_ps(block, block, _CMP_UNORD_Q));
+      best = IsMin ? _mm256_min_ps(best, block) : _mm256_max_ps(best, block);
+    }
+    alignas(32) float lanes[8];
+    _mm256_store_ps(lanes, best);
+    result = lanes[0];
+    for (float lane : lanes) {
+      if (IsMin ? lane < result : lane > result) result = lane;
+    }
+  }
+  *has_nan = _mm256_movemask_ps(nan) != 0;
+  for (; first != last; ++first) {
+    if (*first != *first) *has_nan = true;
+    if (IsMin ? *first < result : *first > result) result = *first;
+  }
+  return result;
+}
+
+S21_TARGET_AVX2 inline std::int64_t SumAvx2(const std::int32_t *first,
+                                            const std::int32_t *last) {
+  __m256i total = _mm256_setzero_si256();
+  for (; last - first >= 8; first += 8) {
+    __m256i block =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(first));
+    total = _mm256_add_epi64(
+        total, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(block)));
+    total = _mm256_add_epi64(
+        total, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(block, 1)));
+  }
+  alignas(32) std::int64_t lanes[4];
+  _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), total);
+  return lanes[0] + lanes[1] + lanes[2] + lanes[3] + SumScalar(first, last);
+}
+
+S21_TARGET_AVX2 inline float SumAvx2(const float *first, const float *last) {
+  __m256 total = _mm256_setzero_ps();
+  for (; last - first >= 8; first += 8) {
+    total = _mm256_add_ps(total, _mm256_loadu_ps(first));
+  }
+  alignas(32) float lanes[8];
+  _mm256_store_ps(lanes, total);
+  float result = 0;
+  for (float lane : lanes) result += lane;
+  return result + SumScalar(first, last);
+}
+#endif  // S21_SIMD_X86
+
+// Dispatching kernels: they run the isa kernels for int32_t and float and the
+// scalar loops for everything else. isa must be supported by the CPU
+
+template <typename T>
+const T *Find(const T *first, const T *last, T value, Isa isa = BestIsa()) {
+#ifdef S21_SIMD_X86
+  if constexpr (HasKernels<T>::value) {
+    if (isa == Isa::kAvx2) return FindAvx2(first, last, value);
+    if (isa == Isa::kSse2) return FindSse2(first, last, value);
+  }
+#endif
+  static_cast<void>(isa);
+  return FindScalar(first, last, value);
+}
+
+template <typename T>
+std::size_t Count(const T *first, const T *last, T value,
+                  Isa isa = BestIsa()) {
+#ifdef S21_SIMD_X86
+  if constexpr (HasKernels<T>::value) {
+    if (isa == Isa::kAvx2) return CountAvx2(first, last, value);
+    if (isa == Isa::kSse2) return CountSse2(first, last, value);
+  }
+#endif
+  static_cast<void>(isa);
+  return CountScalar(first, last, value);
+}
+
+// Extremum() returns the first smallest (IsMin) or the first largest element,
+// last for an empty range. The vector kernels only find the value, its
+// position is looked up with Find(). Ranges with a NaN fall back to
+// std::min_element and std::max_element to keep their results
+template <bool IsMin, typename T>
+const T *Extremum(const T *first, const T *last, Isa isa = BestIsa()) {
+  if (first == last) return last;
+#ifdef S21_SIMD_X86
+  if constexpr (std::is_same_v<T, std::int32_t>) {
+    if (isa == Isa::kAvx2) {
+      return FindAvx2(first, last, ExtremumAvx2<IsMin>(first, last));
+    }
+    if (isa == Isa::kSse2) {
+      return FindSse2(first, last, ExtremumSse2<IsMin>(first, last));
+    }
+  } else if constexpr (std::is_same_v<T, float>) {
+    bool has_nan = false;
+    if (isa == Isa::kAvx2) {
+      float value = ExtremumAvx2<IsMin>(first, last, &has_nan);
+      if (!has_nan) return FindAvx2(first, last, value);
+    } else if (isa == Isa::kSse2) {
+      float value = ExtremumSse2<IsMin>(first, last, &has_nan);
+      if (!has_nan) return FindSse2(first, last, value);
+    }
+  }
+#endif
+  static_cast<void>(isa);
+  return IsMin ? std::min_element(first, last) : std::max_element(first, last);
+}
+
+// Sum() adds up the range, the vector kernels add floats lane by lane, so the
+// rounding may differ from a sequential sum
+template <typename T>
+SumType<T> Sum(const T *first, const T *last, Isa isa = BestIsa()) {
+#ifdef S21_SIMD_X86
+  if constexpr (HasKernels<T>::value) {
+    if (isa == Isa::kAvx2) return SumAvx2(first, last);
+    if (isa == Isa::kSse2) return SumSse2(first, last);
+  }
+#endif
+  static_cast<void>(isa);
+  return SumScalar(first, last);
+}
+}  // namespace simd
+
+// Vectorized algorithms for the contiguous containers (vector, array,
+// small_vector) of arithmetic types. They work on data() and return
+// iterators of the container
+
+// find() returns an iterator to the first element equal to value or end()
+template <typename Container>
+auto find(Container &items, const typename Container::value_type &value)
+    -> decltype(items.begin()) {
+  static_assert(std::is_arithmetic_v<typename Container::value_type>,
+                "s21::find needs an arithmetic element type");
+  auto data = items.data();
+  return items.begin() +
+         (simd::Find(data, data + items.size(), value) - data);
+}
+
+// count() returns the number of elements equal to value
+template <typename Container>
+std::size_t count(const Container &items,
+                  const typename Container::value_type &value) {
+  static_assert(std::is_arithmetic_v<typename Container::value_type>,
+                "s21::count needs an arithmetic element type");
+  return simd::Count(items.data(), items.data() + items.size(), value);
+}
+
+// contains() checks whether there is an element equal to value
+template <typename Container>
+bool contains(const Container &items,
+              const typename Container::value_type &value) {
+  return find(items, value) != items.end();
+}
+
+// min_element() returns an iterator to the first smallest element or end()
+template <typename Container>
+auto min_element(Container &items) -> decltype(items.begin()) {
+  static_assert(std::is_arithmetic_v<typename Container::value_type>,
+                "s21::min_element needs an arithmetic element type");
+  auto data = items.data();
+  return items.begin() +
+         (simd::Extremum<true>(data, data + items.size()) - data);
+}
+
+// max_element() returns an iterator to the first largest element or end()
+template <typename Container>
+auto max_element(Container &items) -> decltype(items.begin()) {
+  static_assert(std::is_arithmetic_v<typename Container::value_type>,
+                "s21::max_element needs an arithmetic element type");
+  auto data = items.data();
+  return items.begin() +
+         (simd::Extremum<false>(data, data + items.size()) - data);
+}
+
+// sum() returns the sum of the elements, integers are added in 64 bits
+template <typename Container>
+simd::SumType<typename Container::value_type> sum(const Container &items) {
+  static_assert(std::is_arithmetic_v<typename Container::value_type>,
+                "s21::sum needs an arithmetic element type");
+  return simd::Sum(items.data(), items.data() + items.size());
+}
+}  // namespace s21
+
+#endif  // SRC_S21_ALGORITHM_H_
@@ -1,49 +1,15 @@
 #ifndef SRC_S21_ARRAY_H_
 #define SRC_S21_ARRAY_H_
 
+#include "s21_iterator.h"
+
 namespace s21 {
 template <typename T, std::size_t S>
 class array {
  public:
-  // Public class Iterator
-  class Iterator {
-   public:
-    using pointer = T *;
-    using reference = T &;
-
-   public:
-    explicit Iterator(pointer ptr);
-    Iterator &operator++();
-    Iterator operator++(int);
-    Iterator &operator--();
-    Iterator operator--(int);
-    bool operator==(const Iterator &other);
-    bool operator!=(const Iterator &other);
-    reference operator*();
-
-   private:
-    pointer ptr_;
-  };
-
-  // Public class ConstIterator
-  class ConstIterator {
-   public:
-    using const_pointer = const T *;
-    using const_reference = const T &;
-
-   public:
-    explicit ConstIterator(const_pointer ptr);
-    ConstIterator &operator++();
-    ConstIterator operator++(int);
-    ConstIterator &operator--();
-    ConstIterator operator--(int);
-    const_reference operator*() const;
-    bool operator==(const ConstIterator &other);
-    bool operator!=(const ConstIterator &other);
-
-   private:
-    const_pointer ptr_;
-  };
+  // Array iterators are random access and wrap a plain pointer
+  using Iterator = ContiguousIterator<T, array>;
+  using ConstIterator = ContiguousIterator<const T, array>;
 
   // Array Member type
   using value_type = T;
@@ -51,7 +17,7 @@ class array {
   using pointer = T *;
   using const_pointer = const T *;
   using iterator = Iterator;
-  using const_iterator = const ConstIterator;
+  using const_iterator = ConstIterator;
   using const_reference = const T &;
   using size_type = size_t;
 
@@ -123,101 +89,6 @@ class array<T, 0> {
   size_t max_size() const noexcept { return 0; }
 };
 
-// Iterator class implementation
-
-template <typename T, std::size_t S>
-array<T, S>::Iterator::Iterator(pointer ptr) : ptr_(ptr) {}
-
-template <typename T, std::size_t S>
-typename array<T, S>::Iterator &array<T, S>::Iterator::operator++() {
-  ++ptr_;
-  return *this;
-}
-
-template <typename T, std::size_t S>
-typename array<T, S>::Iterator array<T, S>::Iterator::operator++(int) {
-  Iterator temp = *this;
-  ++(*this);
-  return temp;
-}
-
-template <typename T, std::size_t S>
-typename array<T, S>::Iterator &array<T, S>::Iterator::operator--() {
-  --ptr_;
-  return *this;
-}
-
-template <typename T, std::size_t S>
-typename array<T, S>::Iterator array<T, S>::Iterator::operator--(int) {
-  Iterator temp = *this;
-  --(*this);
-  return temp;
-}
-
-template <typename T, std::size_t S>
-bool array<T, S>::Iterator::operator==(const Iterator &other) {
-  return ptr_ == other.ptr_;
-}
-
-template <typename T, std::size_t S>
-bool array<T, S>::Iterator::operator!=(const Iterator &other) {
-  return !(ptr_ == other.ptr_);
-}
-
-template <typename T, std::size_t S>
-typename array<T, S>::Iterator::reference array<T, S>::Iterator::operator*() {
-  return *(this->ptr_);
-}
-
-// ConstIterator class implementation
-
-template <typename T, std::size_t S>
-array<T, S>::ConstIterator::ConstIterator(const_pointer ptr) : ptr_(ptr) {}
-
-template <typename T, std::size_t S>
-typename array<T, S>::ConstIterator &array<T, S>::ConstIterator::operator++() {
-  ++ptr_;
-  return *this;
-}
-
-template <typename T, std::size_t S>
-typename array<T, S>::ConstIterator array<T, S>::ConstIterator::operator++(
-    int) {
-  ConstIterator temp = *this;
-  ++(*this);
-  return temp;
-}
-
-template <typename T, std::size_t S>
-typename array<T, S>::ConstIterator &array<T, S>::ConstIterator::operator--() {
-  --ptr_;
-  return *this;
-}
-
-template <typename T, std::size_t S>
-typename array<T, S>::ConstIterator::ConstIterator
-array<T, S>::ConstIterator::operator--(int) {
-  ConstIterator temp = *this;
-  --(*this);
-  return temp;
-}
-
-template <typename T, std::size_t S>
-typename array<T, S>::const_reference array<T, S>::ConstIterator::operator*()
-    const {
-  return *(this->ptr_);
-}
-
-template <typename T, std::size_t S>
-bool array<T, S>::ConstIterator::operator==(const ConstIterator &other) {
-  return ptr_ == other.ptr_;
-}
-
-template <typename T, std::size_t S>
-bool array<T, S>::ConstIterator::operator!=(const ConstIterator &other) {
-  return !(ptr_ == other.ptr_);
-}
-
 // Array class implementation
 
 template <typename T, std::size_t S>
@@ -1,10 +1,23 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
 #include <initializer_list>
 #include <iostream>
+#include <iterator>
 #include <limits>
 #include <memory>
+#include <memory_resource>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 
+#include "s21_algorithm.h"
 #include "s21_list.h"
 #include "s21_map.h"
+#include "s21_node_pool.h"
 #include "s21_queue.h"
 #include "s21_set.h"
 #include "s21_stack.h"
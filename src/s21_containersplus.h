@@ -1,3 +1,26 @@
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include "s21_algorithm.h"
 #include "s21_array.h"
+#include "s21_mapped_vector.h"
+#include "s21_multimap.h"
 #include "s21_multiset.h"
+#include "s21_node_pool.h"
+#include "s21_small_vector.h"
 #include "s21_vector.h"
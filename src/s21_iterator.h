@@ -0,0 +1,190 @@
+#ifndef SRC_S21_ITERATOR_H_
+#define SRC_S21_ITERATOR_H_
+
+namespace s21 {
+// ContiguousIterator is the random access iterator of the containers that keep
+// their elements in one array (vector, array). T is const qualified for the
+// const iterator and Container keeps iterators of different containers apart.
+// It only wraps a pointer, so standard algorithms run on it at pointer speed
+template <typename T, typename Container>
+class ContiguousIterator {
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = std::remove_cv_t<T>;
+  using difference_type = std::ptrdiff_t;
+  using pointer = T *;
+  using reference = T &;
+
+  ContiguousIterator();
+  explicit ContiguousIterator(pointer ptr);
+  // An iterator converts to the const iterator of the same container
+  template <typename U, typename = std::enable_if_t<
+                            std::is_same_v<const U, T> && !std::is_same_v<U, T>>>
+  ContiguousIterator(const ContiguousIterator<U, Container> &other);
+
+  reference operator*() const;
+  pointer operator->() const;
+  reference operator[](difference_type n) const;
+
+  ContiguousIterator &operator++();
+  ContiguousIterator operator++(int);
+  ContiguousIterator &operator--();
+  ContiguousIterator operator--(int);
+  ContiguousIterator &operator+=(difference_type n);
+  ContiguousIterator &operator-=(difference_type n);
+  ContiguousIterator operator+(difference_type n) const;
+  ContiguousIterator operator-(difference_type n) const;
+
+  // base() returns the pointer the iterator wraps
+  pointer base() const;
+
+ private:
+  pointer ptr_;
+};
+
+template <typename T, typename Container>
+ContiguousIterator<T, Container>::ContiguousIterator() : ptr_(nullptr) {}
+
+template <typename T, typename Container>
+ContiguousIterator<T, Container>::ContiguousIterator(pointer ptr) : ptr_(ptr) {}
+
+template <typename T, typename Container>
+template <typename U, typename>
+ContiguousIterator<T, Container>::ContiguousIterator(
+    const ContiguousIterator<U, Container> &other)
+    : ptr_(other.base()) {}
+
+template <typename T, typename Container>
+typename ContiguousIterator<T, Container>::reference
+ContiguousIterator<T, Container>::operator*() const {
+  return *ptr_;
+}
+
+template <typename T, typename Container>
+typename ContiguousIterator<T, Container>::pointer
+ContiguousIterator<T, Container>::operator->() const {
+  return ptr_;
+}
+
+template <typename T, typename Container>
+typename ContiguousIterator<T, Container>::reference
+ContiguousIterator<T, Container>::operator[](difference_type n) const {
+  return ptr_[n];
+}
+
+template <typename T, typename Container>
+ContiguousIterator<T, Container> &
+ContiguousIterator<T, Container>::operator++() {
+  ++ptr_;
+  return *this;
+}
+
+template <typename T, typename Container>
+ContiguousIterator<T, Container> ContiguousIterator<T, Container>::operator++(
+    int) {
+  ContiguousIterator temp = *this;
+  ++ptr_;
+  return temp;
+}
+
+template <typename T, typename Container>
+ContiguousIterator<T, Container> &
+ContiguousIterator<T, Container>::operator--() {
+  --ptr_;
+  return *this;
+}
+
+template <typename T, typename Container>
+ContiguousIterator<T, Container> ContiguousIterator<T, Container>::operator--(
+    int) {
+  ContiguousIterator temp = *this;
+  --ptr_;
+  return temp;
+}
+
+template <typename T, typename Container>
+ContiguousIterator<T, Container> &
+ContiguousIterator<T, Container>::operator+=(difference_type n) {
+  ptr_ += n;
+  return *this;
+}
+
+template <typename T, typename Container>
+ContiguousIterator<T, Container> &
+ContiguousIterator<T, Container>::operator-=(difference_type n) {
+  ptr_ -= n;
+  return *this;
+}
+
+template <typename T, typename Container>
+ContiguousIterator<T, Container> ContiguousIterator<T, Container>::operator+(
+    difference_type n) const {
+  return ContiguousIterator(ptr_ + n);
+}
+
+template <typename T, typename Container>
+ContiguousIterator<T, Container> ContiguousIterator<T, Container>::operator-(
+    difference_type n) const {
+  return ContiguousIterator(ptr_ - n);
+}
+
+template <typename T, typename Container>
+typename ContiguousIterator<T, Container>::pointer
+ContiguousIterator<T, Container>::base() const {
+  return ptr_;
+}
+
+// Non-member operators take both constnesses, so an iterator and a const
+// iterator of the same container compare and subtract with each other
+
+template <typename T, typename Container>
+ContiguousIterator<T, Container> operator+(
+    typename ContiguousIterator<T, Container>::difference_type n,
+    const ContiguousIterator<T, Container> &it) {
+  return it + n;
+}
+
+template <typename T, typename U, typename Container>
+std::ptrdiff_t operator-(const ContiguousIterator<T, Container> &one,
+                         const ContiguousIterator<U, Container> &two) {
+  return one.base() - two.base();
+}
+
+template <typename T, typename U, typename Container>
+bool operator==(const ContiguousIterator<T, Container> &one,
+                const ContiguousIterator<U, Container> &two) {
+  return one.base() == two.base();
+}
+
+template <typename T, typename U, typename Container>
+bool operator!=(const ContiguousIterator<T, Container> &one,
+                const ContiguousIterator<U, Container> &two) {
+  return one.base() != two.base();
+}
+
+template <typename T, typename U, typename Container>
+bool operator<(const ContiguousIterator<T, Container> &one,
+               const ContiguousIterator<U, Container> &two) {
+  return one.base() < two.base();
+}
+
+template <typename T, typename U, typename Container>
+bool operator>(const ContiguousIterator<T, Container> &one,
+               const ContiguousIterator<U, Container> &two) {
+  return one.base() > two.base();
+}
+
+template <typename T, typename U, typename Container>
+bool operator<=(const ContiguousIterator<T, Container> &one,
+                const ContiguousIterator<U, Container> &two) {
+  return one.base() <= two.base();
+}
+
+template <typename T, typename U, typename Container>
+bool operator>=(const ContiguousIterator<T, Container> &one,
+                const ContiguousIterator<U, Container> &two) {
+  return one.base() >= two.base();
+}
+}  // namespace s21
+
+#endif  // SRC_S21_ITERATOR_H_
@@ -1,63 +1,88 @@
 #ifndef SRC_S21_MAP_H_
 #define SRC_S21_MAP_H_
 
+#include "s21_rb_tree.h"
 #include "s21_vector.h"
 
 namespace s21 {
-template <typename Key, typename T>
+template <typename Key, typename T, typename Compare = std::less<Key>,
+          typename Alloc = std::allocator<std::pair<const Key, T>>>
 class Map {
-  class BinaryTreeNode;
-
  public:
   // Map Member Type
-  class TreeIterator;
   using key_type = Key;
   using mapped_type = T;
   using value_type = std::pair<const key_type, mapped_type>;
   using reference = value_type &;
   using const_reference = const value_type &;
-  using iterator = TreeIterator;
-  using const_iterator = TreeIterator;
-  using node = BinaryTreeNode;
+  using node = tree::Node<std::pair<Key, T>>;
+  using iterator = tree::Iterator<node>;
+  using const_iterator = iterator;
   using size_type = size_t;
-  using pointer_to_node = BinaryTreeNode *;
+  using pointer_to_node = node *;
+  using key_compare = Compare;
+  using allocator_type = Alloc;
 
-  // Public class TreeIterator
-  class TreeIterator {
+  // node_type owns an element taken out of the map by extract(). Its key can
+  // be changed before the node is inserted again
+  class node_type : public tree::NodeHandle<node, Alloc> {
     friend class Map;
+    using node_handle = tree::NodeHandle<node, Alloc>;
 
    public:
-    using value_type = std::pair<Key, T>;
-    using pointer_to_node = BinaryTreeNode *;
-    using const_reference = const value_type &;
+    using key_type = Key;
+    using mapped_type = T;
 
-   public:
-    TreeIterator();
-    explicit TreeIterator(pointer_to_node ptr);
-    TreeIterator &operator++();
-    TreeIterator operator++(int);
-    TreeIterator &operator--();
-    TreeIterator operator--(int);
-    const_reference operator*() const;
-    bool operator==(const TreeIterator &other);
-    bool operator!=(const TreeIterator &other);
+    node_type() = default;
+    key_type &key() const;
+    mapped_type &mapped() const;
 
    private:
-    pointer_to_node ptr_;
+    node_type(pointer_to_node node,
+              const typename node_handle::node_allocator &alloc);
+  };
+
+  // What insert(node_type&&) returns; the node stays in the handle when its
+  // key is already present
+  struct insert_return_type {
+    iterator position;
+    bool inserted;
+    node_type node;
   };
+
   // Map Member func
   Map();
+  explicit Map(const Compare &comp,
+               const allocator_type &alloc = allocator_type());
+  explicit Map(const allocator_type &alloc);
   Map(std::initializer_list<value_type> const &items);
+  // Builds a map from a range, in O(n) when it is sorted by key. The tagged
+  // constructors trust the order (and uniqueness) of the keys instead of
+  // checking it
+  template <typename InputIt, typename = typename std::iterator_traits<
+                                  InputIt>::iterator_category>
+  Map(InputIt first, InputIt last, const Compare &comp = Compare());
+  template <typename InputIt>
+  Map(assume_sorted_t, InputIt first, InputIt last,
+      const Compare &comp = Compare());
+  template <typename InputIt>
+  Map(assume_unique_t, InputIt first, InputIt last,
+      const Compare &comp = Compare());
   Map(const Map &m);
   Map(Map &&m);
   ~Map();
   Map &operator=(const Map &m);
   Map &operator=(Map &&m);
+  // Returns the allocator the nodes are allocated with
+  allocator_type get_allocator() const;
+  // Returns the function that orders the keys
+  key_compare key_comp() const;
 
   // Map Element access
-  // Access specified element with bounds checkin
+  // Access or insert specified element, in one descent
   T &operator[](const Key &key);
-  // Access or insert specified element
+  T &operator[](Key &&key);
+  // Access specified element with bounds checking
   T &at(const Key &key);
   const T &at(const Key &key) const;
 
@@ -86,710 +111,580 @@ class Map {
   // Inserts value by key and returns iterator to where the element is in the
   // container and bool denoting whether the insertion took place
   std::pair<iterator, bool> insert(const value_type &value);
+  // Inserts value as close as possible before hint, in amortized O(1) when
+  // that is where its key belongs
+  iterator insert(const_iterator hint, const value_type &value);
+  // Inserts a range, in O(n) when the map is empty and the range is sorted by
+  // key
+  template <typename InputIt, typename = typename std::iterator_traits<
+                                  InputIt>::iterator_category>
+  void insert(InputIt first, InputIt last);
   // Inserts an element or assigns to the current element if the key already
   // exists
   std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj);
+  std::pair<iterator, bool> insert_or_assign(const Key &key, T &&obj);
+  // Constructs the mapped value in place from args if the key is missing,
+  // and leaves args untouched otherwise
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const Key &key, Args &&...args);
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(Key &&key, Args &&...args);
+  template <typename... Args>
+  iterator try_emplace(const_iterator hint, const Key &key, Args &&...args);
+  // Links an extracted node, allocating nothing when the allocators compare
+  // equal
+  insert_return_type insert(node_type &&handle);
+  iterator insert(const_iterator hint, node_type &&handle);
   // Erases element at pos
   void erase(iterator pos);
+  // Unlinks an element and hands its node over without freeing it
+  node_type extract(const_iterator pos);
+  node_type extract(const key_type &key);
   // Swaps the contents
   void swap(Map &other);
   // Splices nodes from another container
   void merge(Map &other);
 
   // Map Lookup
+  // Finds element with key equivalent to key
+  iterator find(const Key &key);
+  const_iterator find(const Key &key) const;
   // Checks if there is an element with key equivalent to key in the container
   bool contains(const Key &key) const;
+  // Returns the range of elements with key equivalent to key
+  std::pair<iterator, iterator> equal_range(const Key &key);
+  std::pair<const_iterator, const_iterator> equal_range(const Key &key) const;
+  // Returns an iterator to the first element with key not less than key
+  iterator lower_bound(const Key &key);
+  const_iterator lower_bound(const Key &key) const;
+  // Returns an iterator to the first element with key greater than key
+  iterator upper_bound(const Key &key);
+  const_iterator upper_bound(const Key &key) const;
+  // Returns a view of the elements with keys in [from, to), empty unless from
+  // is less than to, in O(log n)
+  tree::Range<const_iterator> range(const Key &from, const Key &to) const;
+  // With a transparent Compare the lookups take any type it can compare with
+  // a key, without building a key_type
+  template <typename K, typename = tree::IfTransparent<Compare, K>>
+  T &at(const K &key);
+  template <typename K, typename = tree::IfTransparent<Compare, K>>
+  const T &at(const K &key) const;
+  template <typename K, typename = tree::IfTransparent<Compare, K>>
+  iterator find(const K &key);
+  template <typename K, typename = tree::IfTransparent<Compare, K>>
+  const_iterator find(const K &key) const;
+  template <typename K, typename = tree::IfTransparent<Compare, K>>
+  bool contains(const K &key) const;
+  template <typename K, typename = tree::IfTransparent<Compare, K>>
+  std::pair<iterator, iterator> equal_range(const K &key);
+  template <typename K, typename = tree::IfTransparent<Compare, K>>
+  std::pair<const_iterator, const_iterator> equal_range(const K &key) const;
+  template <typename K, typename = tree::IfTransparent<Compare, K>>
+  iterator lower_bound(const K &key);
+  template <typename K, typename = tree::IfTransparent<Compare, K>>
+  const_iterator lower_bound(const K &key) const;
+  template <typename K, typename = tree::IfTransparent<Compare, K>>
+  iterator upper_bound(const K &key);
+  template <typename K, typename = tree::IfTransparent<Compare, K>>
+  const_iterator upper_bound(const K &key) const;
+  template <typename K, typename = tree::IfTransparent<Compare, K>>
+  tree::Range<const_iterator> range(const K &from, const K &to) const;
 
   // Map Emplace
   // emplace() inserts new elements into the container
   template <typename... Args>
   vector<std::pair<iterator, bool>> emplace(Args &&...args);
+  // emplace_hint() constructs an element and inserts it like insert(hint)
+  template <typename... Args>
+  iterator emplace_hint(const_iterator hint, Args &&...args);
 
  private:
-  pointer_to_node root_;
-  pointer_to_node fake_node_;
-  size_type size_ = 0;
-
-  // Private Node class
-  class BinaryTreeNode {
-   public:
-    using value_type = std::pair<Key, T>;
-    using pointer_to_node = BinaryTreeNode *;
+  using tree_type = tree::RbTree<node, tree::First, Compare, Alloc, true>;
 
-   public:
-    BinaryTreeNode();
-    BinaryTreeNode(value_type data, pointer_to_node top = nullptr,
-                   pointer_to_node left = nullptr,
-                   pointer_to_node right = nullptr);
-    BinaryTreeNode(const BinaryTreeNode &other);
-    BinaryTreeNode(BinaryTreeNode &&other);
-    ~BinaryTreeNode();
-    BinaryTreeNode &operator=(const BinaryTreeNode &other);
-    BinaryTreeNode &operator=(BinaryTreeNode &&other);
-    pointer_to_node NextNode();
-    pointer_to_node PreviousNode();
-    pointer_to_node FarLeft();
-    pointer_to_node FarRight();
-    pointer_to_node FarTop();
-    void CleanNodePointers();
-
-    value_type values_;
-    pointer_to_node top_;
-    pointer_to_node left_;
-    pointer_to_node right_;
-  };
+  tree_type tree_;
 
   // Map Helper Methods
-  void DeleteNodes(pointer_to_node node);
-  bool HelperForInsert(pointer_to_node node);
-  pointer_to_node RecursiveFind(const Key &key, pointer_to_node node) const;
-  void InsertForMerge(pointer_to_node node);
-  void erase_helper(pointer_to_node node);
-  void erase_helper_2(pointer_to_node node);
-  void erase_helper_3(pointer_to_node node);
-  void EraseLeafNode(pointer_to_node node_to_erase);
-  void EraseNodeOneChildren(pointer_to_node node);
-  void EraseNodeTwoChildren(pointer_to_node node);
-  void while_for_insert(pointer_to_node node, bool &code);
-  void EraseLogicForMerge(Map &other, pointer_to_node node);
-  void EraseLogicForLeafNode(Map &other, pointer_to_node node_to_erase);
-  void EraseLogicForOneChildrenNode(Map &other, pointer_to_node node);
-  void EraseLogicForTwoChildrenNode(Map &other, pointer_to_node node_to_erase);
-  void RecursiveCopyWholeSet(pointer_to_node node, const Map &other);
-  void CopySwap(Map &one, Map &two) noexcept;
-  std::pair<iterator, bool> InsertResult(std::pair<Key, T> val);
+  mapped_type &Mapped(const_iterator pos) const;
+  template <typename K>
+  const_iterator FindOrThrow(const K &key) const;
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> TryEmplace(K &&key, Args &&...args);
 };
 
-// TreeIterator class implementation
-template <typename Key, typename T>
-Map<Key, T>::TreeIterator::TreeIterator() : ptr_(nullptr) {}
+// node_type class implementation
 
-template <typename Key, typename T>
-Map<Key, T>::TreeIterator::TreeIterator(pointer_to_node ptr) : ptr_(ptr) {}
+template <typename Key, typename T, typename Compare, typename Alloc>
+Map<Key, T, Compare, Alloc>::node_type::node_type(
+    pointer_to_node node, const typename node_handle::node_allocator &alloc)
+    : node_handle(node, alloc) {}
 
-template <typename Key, typename T>
-typename Map<Key, T>::TreeIterator &Map<Key, T>::TreeIterator::operator++() {
-  if (ptr_ == ptr_->FarTop()->FarRight()) {
-    --(*this);
-  } else {
-    ptr_ = ptr_->NextNode();
-  }
-  return *this;
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename Map<Key, T, Compare, Alloc>::key_type &
+Map<Key, T, Compare, Alloc>::node_type::key() const {
+  return this->node_->value_.first;
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename Map<Key, T, Compare, Alloc>::mapped_type &
+Map<Key, T, Compare, Alloc>::node_type::mapped() const {
+  return this->node_->value_.second;
+}
+
+// Map class implementation
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+Map<Key, T, Compare, Alloc>::Map() : Map(Compare()) {}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+Map<Key, T, Compare, Alloc>::Map(const Compare &comp,
+                                 const allocator_type &alloc)
+    : tree_(comp, typename tree_type::node_allocator(alloc)) {}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+Map<Key, T, Compare, Alloc>::Map(const allocator_type &alloc)
+    : Map(Compare(), alloc) {}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+Map<Key, T, Compare, Alloc>::Map(std::initializer_list<value_type> const &items)
+    : Map() {
+  tree_.InsertRange(items.begin(), items.end(), true, true);
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+template <typename InputIt, typename>
+Map<Key, T, Compare, Alloc>::Map(InputIt first, InputIt last,
+                                 const Compare &comp)
+    : Map(comp) {
+  tree_.InsertRange(first, last, true, true);
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::TreeIterator Map<Key, T>::TreeIterator::operator++(int) {
-  TreeIterator temp = *this;
-  ++(*this);
-  return temp;
+template <typename Key, typename T, typename Compare, typename Alloc>
+template <typename InputIt>
+Map<Key, T, Compare, Alloc>::Map(assume_sorted_t, InputIt first, InputIt last,
+                                 const Compare &comp)
+    : Map(comp) {
+  tree_.InsertRange(first, last, false, true);
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::TreeIterator &Map<Key, T>::TreeIterator::operator--() {
-  if (ptr_ == ptr_->FarTop()->FarLeft()) {
-    ptr_ = ptr_->FarTop()->FarRight();
-  } else {
-    ptr_ = ptr_->PreviousNode();
+template <typename Key, typename T, typename Compare, typename Alloc>
+template <typename InputIt>
+Map<Key, T, Compare, Alloc>::Map(assume_unique_t, InputIt first, InputIt last,
+                                 const Compare &comp)
+    : Map(comp) {
+  tree_.InsertRange(first, last, false, false);
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+Map<Key, T, Compare, Alloc>::Map(const Map &m) : tree_(m.tree_) {}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+Map<Key, T, Compare, Alloc>::Map(Map &&m) : tree_(std::move(m.tree_)) {}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+Map<Key, T, Compare, Alloc>::~Map() = default;
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+Map<Key, T, Compare, Alloc> &Map<Key, T, Compare, Alloc>::operator=(
+    const Map<Key, T, Compare, Alloc> &m) {
+  if (this != &m) {
+    Map temp(m);
+    swap(temp);
   }
   return *this;
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::TreeIterator::TreeIterator
-Map<Key, T>::TreeIterator::operator--(int) {
-  TreeIterator temp = *this;
-  --(*this);
-  return temp;
+template <typename Key, typename T, typename Compare, typename Alloc>
+Map<Key, T, Compare, Alloc> &Map<Key, T, Compare, Alloc>::operator=(
+    Map<Key, T, Compare, Alloc> &&m) {
+  if (this != &m) {
+    Map temp(std::move(m));
+    swap(temp);
+  }
+  return *this;
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::TreeIterator::const_reference
-Map<Key, T>::TreeIterator::operator*() const {
-  return ptr_->values_;
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename Map<Key, T, Compare, Alloc>::allocator_type
+Map<Key, T, Compare, Alloc>::get_allocator() const {
+  return allocator_type(tree_.GetAllocator());
 }
 
-template <typename Key, typename T>
-bool Map<Key, T>::TreeIterator::operator==(const TreeIterator &other) {
-  return ptr_ == other.ptr_;
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename Map<Key, T, Compare, Alloc>::key_compare
+Map<Key, T, Compare, Alloc>::key_comp() const {
+  return tree_.KeyComp();
 }
 
-template <typename Key, typename T>
-bool Map<Key, T>::TreeIterator::operator!=(const TreeIterator &other) {
-  return !(ptr_ == other.ptr_);
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename Map<Key, T, Compare, Alloc>::mapped_type &
+Map<Key, T, Compare, Alloc>::operator[](const Key &key) {
+  return Mapped(TryEmplace(key).first);
 }
 
-// BinaryNodeTree class implementation
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename Map<Key, T, Compare, Alloc>::mapped_type &
+Map<Key, T, Compare, Alloc>::operator[](Key &&key) {
+  return Mapped(TryEmplace(std::move(key)).first);
+}
 
-template <typename Key, typename T>
-Map<Key, T>::BinaryTreeNode::BinaryTreeNode()
-    : top_(nullptr), left_(nullptr), right_(nullptr) {}
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename Map<Key, T, Compare, Alloc>::mapped_type &
+Map<Key, T, Compare, Alloc>::at(const Key &key) {
+  return Mapped(FindOrThrow(key));
+}
 
-template <typename Key, typename T>
-Map<Key, T>::BinaryTreeNode::BinaryTreeNode(value_type data,
-                                            pointer_to_node top,
-                                            pointer_to_node left,
-                                            pointer_to_node right)
-    : values_(data), top_(top), left_(left), right_(right) {}
+template <typename Key, typename T, typename Compare, typename Alloc>
+const typename Map<Key, T, Compare, Alloc>::mapped_type &
+Map<Key, T, Compare, Alloc>::at(const Key &key) const {
+  return Mapped(FindOrThrow(key));
+}
 
-template <typename Key, typename T>
-Map<Key, T>::BinaryTreeNode::BinaryTreeNode(const BinaryTreeNode &other) {
-  *this = other;
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename Map<Key, T, Compare, Alloc>::iterator
+Map<Key, T, Compare, Alloc>::begin() {
+  return tree_.Begin();
 }
 
-template <typename Key, typename T>
-Map<Key, T>::BinaryTreeNode::BinaryTreeNode(BinaryTreeNode &&other) = default;
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename Map<Key, T, Compare, Alloc>::const_iterator
+Map<Key, T, Compare, Alloc>::begin() const {
+  return tree_.Begin();
+}
 
-template <typename Key, typename T>
-Map<Key, T>::BinaryTreeNode::~BinaryTreeNode() = default;
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename Map<Key, T, Compare, Alloc>::iterator
+Map<Key, T, Compare, Alloc>::end() {
+  return tree_.End();
+}
 
-template <typename Key, typename T>
-typename Map<Key, T>::BinaryTreeNode &Map<Key, T>::BinaryTreeNode::operator=(
-    const BinaryTreeNode &other) {
-  if (this != &other) {
-    values_ = other.values_;
-    top_ = other.top_;
-    left_ = other.left_;
-    right_ = other.right_;
-  }
-  return *this;
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename Map<Key, T, Compare, Alloc>::const_iterator
+Map<Key, T, Compare, Alloc>::end() const {
+  return tree_.End();
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::BinaryTreeNode &Map<Key, T>::BinaryTreeNode::operator=(
-    BinaryTreeNode &&other) = default;
-
-template <typename Key, typename T>
-typename Map<Key, T>::BinaryTreeNode::pointer_to_node
-Map<Key, T>::BinaryTreeNode::NextNode() {
-  pointer_to_node temp = this;
-  if (temp->right_) {
-    temp = temp->right_;
-    while (temp->left_) temp = temp->left_;
-  } else {
-    while (temp->top_ && temp == temp->top_->right_) {
-      temp = temp->top_;
-    }
-    temp = temp->top_;
-  }
-  return temp;
-}
-
-template <typename Key, typename T>
-typename Map<Key, T>::BinaryTreeNode::pointer_to_node
-Map<Key, T>::BinaryTreeNode::PreviousNode() {
-  pointer_to_node temp = this;
-  if (temp->left_) {
-    temp = temp->left_;
-    while (temp->right_) temp = temp->right_;
-  } else {
-    while (temp->top_ && temp == temp->top_->left_) {
-      temp = temp->top_;
-    }
-    temp = temp->top_;
-  }
-  return temp;
+template <typename Key, typename T, typename Compare, typename Alloc>
+bool Map<Key, T, Compare, Alloc>::empty() const {
+  return tree_.Size() == 0;
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::BinaryTreeNode::pointer_to_node
-Map<Key, T>::BinaryTreeNode::FarLeft() {
-  pointer_to_node temp(this);
-  while (temp->left_) temp = temp->left_;
-  return temp;
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename Map<Key, T, Compare, Alloc>::size_type
+Map<Key, T, Compare, Alloc>::size() const {
+  return tree_.Size();
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::BinaryTreeNode::pointer_to_node
-Map<Key, T>::BinaryTreeNode::FarRight() {
-  pointer_to_node temp(this);
-  while (temp->right_) temp = temp->right_;
-  return temp;
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename Map<Key, T, Compare, Alloc>::size_type
+Map<Key, T, Compare, Alloc>::max_size() const {
+  std::allocator<std::pair<Key, T>> alloc;
+  return alloc.max_size() / 5;
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::BinaryTreeNode::pointer_to_node
-Map<Key, T>::BinaryTreeNode::FarTop() {
-  pointer_to_node temp(this);
-  while (temp->top_) temp = temp->top_;
-  return temp;
+template <typename Key, typename T, typename Compare, typename Alloc>
+void Map<Key, T, Compare, Alloc>::clear() {
+  tree_.Clear();
 }
 
-template <typename Key, typename T>
-void Map<Key, T>::BinaryTreeNode::CleanNodePointers() {
-  top_ = nullptr;
-  left_ = nullptr;
-  right_ = nullptr;
+template <typename Key, typename T, typename Compare, typename Alloc>
+std::pair<typename Map<Key, T, Compare, Alloc>::iterator, bool>
+Map<Key, T, Compare, Alloc>::insert(const value_type &value) {
+  return tree_.Emplace(value.first, value);
 }
 
-// Map class implementation
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename Map<Key, T, Compare, Alloc>::iterator
+Map<Key, T, Compare, Alloc>::insert(const_iterator hint,
+                                    const value_type &value) {
+  return tree_.EmplaceHint(hint, value.first, value).first;
+}
 
-template <typename Key, typename T>
-Map<Key, T>::Map() {
-  root_ = new node();
-  fake_node_ = new node();
-  root_->right_ = fake_node_;
-  fake_node_->top_ = root_;
+template <typename Key, typename T, typename Compare, typename Alloc>
+std::pair<typename Map<Key, T, Compare, Alloc>::iterator, bool>
+Map<Key, T, Compare, Alloc>::insert(const key_type &key,
+                                    const mapped_type &obj) {
+  return TryEmplace(key, obj);
 }
 
-template <typename Key, typename T>
-Map<Key, T>::Map(std::initializer_list<value_type> const &items) : Map() {
-  for (auto const &item : items) {
-    insert(item);
-  }
+template <typename Key, typename T, typename Compare, typename Alloc>
+template <typename InputIt, typename>
+void Map<Key, T, Compare, Alloc>::insert(InputIt first, InputIt last) {
+  tree_.InsertRange(first, last, true, true);
 }
 
-template <typename Key, typename T>
-Map<Key, T>::Map(const Map &m) : Map() {
-  if (m.size_ > 0) {
-    RecursiveCopyWholeSet(m.root_, m);
-    size_ = m.size_;
-  }
+template <typename Key, typename T, typename Compare, typename Alloc>
+std::pair<typename Map<Key, T, Compare, Alloc>::iterator, bool>
+Map<Key, T, Compare, Alloc>::insert_or_assign(const Key &key, const T &obj) {
+  std::pair<iterator, bool> result = TryEmplace(key, obj);
+  if (!result.second) Mapped(result.first) = obj;
+  return result;
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+std::pair<typename Map<Key, T, Compare, Alloc>::iterator, bool>
+Map<Key, T, Compare, Alloc>::insert_or_assign(const Key &key, T &&obj) {
+  std::pair<iterator, bool> result = TryEmplace(key, std::move(obj));
+  if (!result.second) Mapped(result.first) = std::move(obj);
+  return result;
 }
 
-template <typename Key, typename T>
-Map<Key, T>::Map(Map &&m) : Map() {
-  CopySwap(*this, m);
-  m.size_ = 0;
+template <typename Key, typename T, typename Compare, typename Alloc>
+template <typename... Args>
+std::pair<typename Map<Key, T, Compare, Alloc>::iterator, bool>
+Map<Key, T, Compare, Alloc>::try_emplace(const Key &key, Args &&...args) {
+  return TryEmplace(key, std::forward<Args>(args)...);
 }
 
-template <typename Key, typename T>
-Map<Key, T>::~Map() {
-  clear();
-  delete fake_node_;
-  delete root_;
+template <typename Key, typename T, typename Compare, typename Alloc>
+template <typename... Args>
+std::pair<typename Map<Key, T, Compare, Alloc>::iterator, bool>
+Map<Key, T, Compare, Alloc>::try_emplace(Key &&key, Args &&...args) {
+  return TryEmplace(std::move(key), std::forward<Args>(args)...);
 }
 
-template <typename Key, typename T>
-Map<Key, T> &Map<Key, T>::operator=(Map<Key, T> &&m) {
-  if (this != &m) {
-    m->root_ = nullptr;
-    root_ = m->root_;
-    size_ = m->size;
-  }
-  return *this;
+template <typename Key, typename T, typename Compare, typename Alloc>
+template <typename... Args>
+typename Map<Key, T, Compare, Alloc>::iterator
+Map<Key, T, Compare, Alloc>::try_emplace(const_iterator hint, const Key &key,
+                                         Args &&...args) {
+  return tree_
+      .EmplaceHint(hint, key, std::piecewise_construct,
+                   std::forward_as_tuple(key),
+                   std::forward_as_tuple(std::forward<Args>(args)...))
+      .first;
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::mapped_type &Map<Key, T>::operator[](const Key &key) {
-  node *findNode = RecursiveFind(key, root_);
-  if (findNode == fake_node_) {
-    insert(key, mapped_type());
-    findNode = RecursiveFind(key, root_);
-  }
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename Map<Key, T, Compare, Alloc>::insert_return_type
+Map<Key, T, Compare, Alloc>::insert(node_type &&handle) {
+  std::pair<iterator, bool> result = tree_.Reinsert(handle);
+  return insert_return_type{result.first, result.second, std::move(handle)};
+}
 
-  return findNode->values_.second;
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename Map<Key, T, Compare, Alloc>::iterator
+Map<Key, T, Compare, Alloc>::insert(const_iterator hint, node_type &&handle) {
+  return tree_.Reinsert(hint, handle).first;
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::mapped_type &Map<Key, T>::at(const Key &key) {
-  node *findNode = RecursiveFind(key, root_);
-  if (findNode == fake_node_) {
-    throw std::out_of_range("No such element");
-  }
-  return findNode->values_.second;
+template <typename Key, typename T, typename Compare, typename Alloc>
+void Map<Key, T, Compare, Alloc>::erase(iterator pos) {
+  tree_.Erase(pos);
 }
 
-template <typename Key, typename T>
-const typename Map<Key, T>::mapped_type &Map<Key, T>::at(const Key &key) const {
-  node *findNode = RecursiveFind(key, root_);
-  if (findNode == fake_node_) {
-    throw std::out_of_range("No such element");
-  }
-  return findNode->values_.second;
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename Map<Key, T, Compare, Alloc>::node_type
+Map<Key, T, Compare, Alloc>::extract(const_iterator pos) {
+  return node_type(tree_.Extract(pos), tree_.GetAllocator());
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::iterator Map<Key, T>::begin() {
-  return empty() ? end() : iterator(root_->FarLeft());
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename Map<Key, T, Compare, Alloc>::node_type
+Map<Key, T, Compare, Alloc>::extract(const key_type &key) {
+  iterator found = find(key);
+  if (found == end()) return node_type();
+  return extract(found);
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::const_iterator Map<Key, T>::begin() const {
-  return empty() ? end() : iterator(root_->FarLeft());
+// merge() relinks the nodes of other whose keys are missing here
+template <typename Key, typename T, typename Compare, typename Alloc>
+void Map<Key, T, Compare, Alloc>::merge(Map &other) {
+  tree_.Merge(other.tree_);
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::iterator Map<Key, T>::end() {
-  return iterator(root_->FarRight());
+template <typename Key, typename T, typename Compare, typename Alloc>
+void Map<Key, T, Compare, Alloc>::swap(Map &other) {
+  tree_.Swap(other.tree_);
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::const_iterator Map<Key, T>::end() const {
-  return iterator(root_->FarRight());
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename Map<Key, T, Compare, Alloc>::iterator
+Map<Key, T, Compare, Alloc>::find(const Key &key) {
+  return tree_.Find(key);
 }
 
-template <typename Key, typename T>
-bool Map<Key, T>::empty() const {
-  return size_ == 0;
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename Map<Key, T, Compare, Alloc>::const_iterator
+Map<Key, T, Compare, Alloc>::find(const Key &key) const {
+  return tree_.Find(key);
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::size_type Map<Key, T>::size() const {
-  return size_;
+template <typename Key, typename T, typename Compare, typename Alloc>
+bool Map<Key, T, Compare, Alloc>::contains(const Key &key) const {
+  return tree_.Find(key) != tree_.End();
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::size_type Map<Key, T>::max_size() const {
-  std::allocator<std::pair<Key, T>> Alloc;
-  return Alloc.max_size() / 5;
+template <typename Key, typename T, typename Compare, typename Alloc>
+template <typename K, typename>
+T &Map<Key, T, Compare, Alloc>::at(const K &key) {
+  return Mapped(FindOrThrow(key));
 }
 
-template <typename Key, typename T>
-void Map<Key, T>::clear() {
-  DeleteNodes(root_);
-  root_->left_ = nullptr;
-  root_->right_ = fake_node_;
-  fake_node_->top_ = root_;
-  size_ = 0;
-  fake_node_->values_.first = size_;
+template <typename Key, typename T, typename Compare, typename Alloc>
+template <typename K, typename>
+const T &Map<Key, T, Compare, Alloc>::at(const K &key) const {
+  return Mapped(FindOrThrow(key));
 }
 
-template <typename Key, typename T>
-std::pair<typename Map<Key, T>::iterator, bool> Map<Key, T>::insert(
-    const value_type &value) {
-  std::pair<Key, T> val = {value.first, value.second};
-  return InsertResult(val);
+template <typename Key, typename T, typename Compare, typename Alloc>
+template <typename K, typename>
+typename Map<Key, T, Compare, Alloc>::iterator
+Map<Key, T, Compare, Alloc>::find(const K &key) {
+  return tree_.Find(key);
 }
 
-template <typename Key, typename T>
-std::pair<typename Map<Key, T>::iterator, bool> Map<Key, T>::insert(
-    const key_type &key, const mapped_type &obj) {
-  std::pair<Key, T> val = {key, obj};
-  return InsertResult(val);
+template <typename Key, typename T, typename Compare, typename Alloc>
+template <typename K, typename>
+typename Map<Key, T, Compare, Alloc>::const_iterator
+Map<Key, T, Compare, Alloc>::find(const K &key) const {
+  return tree_.Find(key);
 }
 
-template <typename Key, typename T>
-std::pair<typename Map<Key, T>::iterator, bool> Map<Key, T>::insert_or_assign(
-    const Key &key, const T &obj) {
-  std::pair<Key, T> val = {key, obj};
-  bool result = false;
-  typename Map<Key, T>::pointer_to_node findNode =
-      RecursiveFind(key, Map<Key, T>::root_);
-  if (findNode == Map<Key, T>::fake_node_) {
-    insert(val);
-    result = true;
-    typename Map<Key, T>::pointer_to_node resNode =
-        RecursiveFind(key, Map<Key, T>::root_);
-    return std::make_pair(typename Map<Key, T>::iterator(resNode), result);
-  } else {
-    findNode->values_.second = val.second;
-  }
+template <typename Key, typename T, typename Compare, typename Alloc>
+template <typename K, typename>
+bool Map<Key, T, Compare, Alloc>::contains(const K &key) const {
+  return tree_.Find(key) != tree_.End();
+}
 
-  return std::make_pair(typename Map<Key, T>::iterator(findNode), result);
-}
-
-template <typename Key, typename T>
-void Map<Key, T>::erase(iterator pos) {
-  pointer_to_node current = pos.ptr_;
-  if (current == end().ptr_) {
-    throw std::logic_error(
-        "The end() iterator cannot be used as a value for pos\n");
-  } else if (!current->left_ &&
-             (!current->right_ || current->right_ == fake_node_)) {
-    erase_helper(current);
-  } else if ((current->left_ && !current->right_) ||
-             (!current->left_ && current->right_)) {
-    erase_helper_2(current);
-  } else if (current->left_ && current->right_) {
-    erase_helper_3(current);
-  }
-  --size_;
-  fake_node_->values_.first = size_;
-}
-
-template <typename Key, typename T>
-void Map<Key, T>::merge(Map &other) {
-  for (auto i = other.root_->FarLeft(); i != other.root_->FarRight();) {
-    pointer_to_node to_merge = i;
-    if (!contains(to_merge->values_.first)) {
-      i = i->NextNode();
-      EraseLogicForMerge(other, to_merge);
-      InsertForMerge(to_merge);
-      ++size_;
-      fake_node_->values_.first = size_;
-    } else {
-      i = i->NextNode();
-    }
-  }
+template <typename Key, typename T, typename Compare, typename Alloc>
+std::pair<typename Map<Key, T, Compare, Alloc>::iterator,
+          typename Map<Key, T, Compare, Alloc>::iterator>
+Map<Key, T, Compare, Alloc>::equal_range(const Key &key) {
+  return tree_.EqualRange(key);
 }
 
-template <typename Key, typename T>
-void Map<Key, T>::swap(Map &other) {
-  CopySwap(*this, other);
+template <typename Key, typename T, typename Compare, typename Alloc>
+std::pair<typename Map<Key, T, Compare, Alloc>::const_iterator,
+          typename Map<Key, T, Compare, Alloc>::const_iterator>
+Map<Key, T, Compare, Alloc>::equal_range(const Key &key) const {
+  return tree_.EqualRange(key);
 }
 
-template <typename Key, typename T>
-bool Map<Key, T>::contains(const Key &key) const {
-  return RecursiveFind(key, root_) == end().ptr_ ? false : true;
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename Map<Key, T, Compare, Alloc>::iterator
+Map<Key, T, Compare, Alloc>::lower_bound(const Key &key) {
+  return tree_.LowerBound(key);
 }
 
-template <typename Key, typename T>
-template <typename... Args>
-vector<std::pair<typename Map<Key, T>::iterator, bool>> Map<Key, T>::emplace(
-    Args &&...args) {
-  vector<std::pair<iterator, bool>> result = {(insert(args))...};
-  return result;
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename Map<Key, T, Compare, Alloc>::const_iterator
+Map<Key, T, Compare, Alloc>::lower_bound(const Key &key) const {
+  return tree_.LowerBound(key);
 }
 
-template <typename Key, typename T>
-void Map<Key, T>::DeleteNodes(pointer_to_node node) {
-  if (node) {
-    DeleteNodes(node->left_);
-    DeleteNodes(node->right_);
-    if (node != root_ && node != fake_node_) {
-      delete node;
-    }
-  }
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename Map<Key, T, Compare, Alloc>::iterator
+Map<Key, T, Compare, Alloc>::upper_bound(const Key &key) {
+  return tree_.UpperBound(key);
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::pointer_to_node Map<Key, T>::RecursiveFind(
-    const Key &key, pointer_to_node node) const {
-  if (node == fake_node_ || size_ == 0 || !node) return end().ptr_;
-  if (key == node->values_.first) {
-    return node;
-  } else {
-    return (key < node->values_.first) ? RecursiveFind(key, node->left_)
-                                       : RecursiveFind(key, node->right_);
-  }
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename Map<Key, T, Compare, Alloc>::const_iterator
+Map<Key, T, Compare, Alloc>::upper_bound(const Key &key) const {
+  return tree_.UpperBound(key);
 }
 
-template <typename Key, typename T>
-std::pair<typename Map<Key, T>::iterator, bool> Map<Key, T>::InsertResult(
-    std::pair<Key, T> val) {
-  node *temp = new node(val);
-  if (empty()) {
-    root_->values_.second = val.second;
-    root_->values_.first = val.first;
-    ++size_;
-    fake_node_->values_.first = size_;
-    iterator res(root_);
-    delete temp;
-    return std::pair<Map<Key, T>::iterator, bool>(res, true);
-  } else if (HelperForInsert(temp)) {
-    ++size_;
-    fake_node_->values_.first = size_;
-    iterator res(temp);
-    return std::pair<Map<Key, T>::iterator, bool>(res, true);
-  }
-  return std::make_pair(Map<Key, T>::iterator(RecursiveFind(val.first, root_)),
-                        false);
-}
-
-template <typename Key, typename T>
-bool Map<Key, T>::HelperForInsert(pointer_to_node node) {
-  bool code = true;
-  while_for_insert(node, code);
-  return code;
-}
-
-template <typename Key, typename T>
-void Map<Key, T>::while_for_insert(pointer_to_node node, bool &code) {
-  pointer_to_node Current = root_;
-  while (true) {
-    if (node->values_.first < Current->values_.first) {
-      if (Current->left_ == nullptr) {
-        Current->left_ = node;
-        node->top_ = Current;
-        break;
-      } else {
-        Current = Current->left_;
-      }
-    } else if ((node->values_.first > Current->values_.first) &&
-               Current != fake_node_) {
-      if (Current->right_ == nullptr) {
-        Current->right_ = node;
-        node->top_ = Current;
-        break;
-      } else {
-        Current = Current->right_;
-      }
-    } else if (Current == fake_node_) {
-      fake_node_->top_->right_ = node;
-      node->top_ = fake_node_->top_;
-      node->right_ = fake_node_;
-      fake_node_->top_ = node;
-      break;
-    } else {
-      code = false;
-      delete node;
-      break;
-    }
-  }
+template <typename Key, typename T, typename Compare, typename Alloc>
+tree::Range<typename Map<Key, T, Compare, Alloc>::const_iterator>
+Map<Key, T, Compare, Alloc>::range(const Key &from, const Key &to) const {
+  return tree_.RangeOf(from, to);
 }
 
-template <typename Key, typename T>
-void Map<Key, T>::erase_helper(pointer_to_node node) {
-  if (node == root_ && node->right_ == fake_node_) {
-    delete root_;
-    root_ = new BinaryTreeNode();
-    root_->right_ = fake_node_;
-    fake_node_->top_ = root_;
-    return;
-  }
-  if (node->top_->left_ == node) {
-    node->top_->left_ = nullptr;
-  } else {
-    if (node->right_ == fake_node_) {
-      node->top_->right_ = fake_node_;
-    } else {
-      node->top_->right_ = nullptr;
-    }
-  }
-  delete node;
-}
-
-template <typename Key, typename T>
-void Map<Key, T>::erase_helper_2(pointer_to_node node) {
-  pointer_to_node child = (node->left_) ? node->left_ : node->right_;
-  if (node != root_) {
-    if (node == node->top_->left_) {
-      node->top_->left_ = child;
-      child->top_ = node->top_;
-    } else {
-      node->top_->right_ = child;
-      child->top_ = node->top_;
-    }
-  } else {
-    root_ = child;
-    root_->top_ = nullptr;
-  }
-  delete node;
-}
-
-template <typename Key, typename T>
-void Map<Key, T>::erase_helper_3(pointer_to_node node) {
-  pointer_to_node prev = node->PreviousNode();
-  pointer_to_node &parent_pointer =
-      (prev == prev->top_->left_) ? prev->top_->left_ : prev->top_->right_;
-  if (prev->left_) {
-    prev->left_->top_ = prev->top_;
-    parent_pointer = prev->left_;
-  } else {
-    parent_pointer = nullptr;
-  }
-  node->values_.first = prev->values_.first;
-  node->values_.second = prev->values_.second;
-  delete prev;
-}
-
-template <typename Key, typename T>
-void Map<Key, T>::CopySwap(Map &one, Map &two) noexcept {
-  using std::swap;
-  swap(one.root_, two.root_);
-  swap(one.fake_node_, two.fake_node_);
-  swap(one.size_, two.size_);
-}
-
-template <typename Key, typename T>
-void Map<Key, T>::RecursiveCopyWholeSet(pointer_to_node node,
-                                        const Map &other) {
-  if (empty()) insert(node->values_.first, node->values_.second);
-  if (node->left_)
-    insert(node->left_->values_.first, node->left_->values_.second);
-  if (node->right_ && node->right_ != other.fake_node_)
-    insert(node->right_->values_.first, node->right_->values_.second);
-  if (node->left_) RecursiveCopyWholeSet(node->left_, other);
-  if (node->right_ && node->right_ != other.fake_node_)
-    RecursiveCopyWholeSet(node->right_, other);
-}
-
-template <typename Key, typename T>
-void Map<Key, T>::EraseLogicForMerge(Map &other, pointer_to_node node) {
-  pointer_to_node current = node;
-  if (!current->left_ &&
-      (!current->right_ || current->right_ == other.fake_node_)) {
-    EraseLogicForLeafNode(other, current);
-  } else if ((current->left_ && !current->right_) ||
-             (!current->left_ && current->right_)) {
-    EraseLogicForOneChildrenNode(other, current);
-  } else if (current->left_ && current->right_) {
-    EraseLogicForTwoChildrenNode(other, current);
-  }
-  --other.size_;
-  other.fake_node_->values_.first = other.size_;
-}
-
-template <typename Key, typename T>
-void Map<Key, T>::EraseLogicForLeafNode(Map &other,
-                                        pointer_to_node node_to_erase) {
-  if (node_to_erase == other.root_ &&
-      node_to_erase->right_ == other.fake_node_) {
-    other.root_ = new node();
-    other.root_->right_ = other.fake_node_;
-    other.fake_node_->top_ = other.root_;
-    return;
-  }
-  if (node_to_erase->top_->left_ == node_to_erase) {
-    node_to_erase->top_->left_ = nullptr;
-  } else {
-    if (node_to_erase->right_ == other.fake_node_) {
-      node_to_erase->top_->right_ = other.fake_node_;
-    } else {
-      node_to_erase->top_->right_ = nullptr;
-    }
-  }
+template <typename Key, typename T, typename Compare, typename Alloc>
+template <typename K, typename>
+std::pair<typename Map<Key, T, Compare, Alloc>::iterator,
+          typename Map<Key, T, Compare, Alloc>::iterator>
+Map<Key, T, Compare, Alloc>::equal_range(const K &key) {
+  return tree_.EqualRange(key);
 }
 
-template <typename Key, typename T>
-void Map<Key, T>::EraseLogicForOneChildrenNode(Map &other,
-                                               pointer_to_node node) {
-  pointer_to_node child = (node->left_) ? node->left_ : node->right_;
-  if (node != other.root_) {
-    if (node == node->top_->left_) {
-      node->top_->left_ = child;
-      child->top_ = node->top_;
-    } else {
-      node->top_->right_ = child;
-      child->top_ = node->top_;
-    }
-  } else {
-    other.root_ = child;
-    other.root_->top_ = nullptr;
-  }
+template <typename Key, typename T, typename Compare, typename Alloc>
+template <typename K, typename>
+std::pair<typename Map<Key, T, Compare, Alloc>::const_iterator,
+          typename Map<Key, T, Compare, Alloc>::const_iterator>
+Map<Key, T, Compare, Alloc>::equal_range(const K &key) const {
+  return tree_.EqualRange(key);
 }
 
-template <typename Key, typename T>
-void Map<Key, T>::EraseLogicForTwoChildrenNode(Map &other,
-                                               pointer_to_node node_to_erase) {
-  pointer_to_node replace = new node();
-  if (node_to_erase->top_) {
-    if (node_to_erase->top_->left_ == node_to_erase) {
-      node_to_erase->top_->left_ = replace;
-    } else {
-      node_to_erase->top_->right_ = replace;
-    }
-  } else {
-    other.root_ = replace;
-  }
-  if (node_to_erase->left_) node_to_erase->left_->top_ = replace;
-  if (node_to_erase->right_) node_to_erase->right_->top_ = replace;
-  *replace = *node_to_erase;
-  pointer_to_node prev = replace->PreviousNode();
-  pointer_to_node &parent_pointer =
-      (prev == prev->top_->left_) ? prev->top_->left_ : prev->top_->right_;
-  if (prev->left_) {
-    prev->left_->top_ = prev->top_;
-    parent_pointer = prev->left_;
-  } else {
-    parent_pointer = nullptr;
-  }
-  replace->values_ = prev->values_;
-  delete prev;
-}
-
-template <typename Key, typename T>
-void Map<Key, T>::InsertForMerge(pointer_to_node node) {
-  if (empty()) {
-    delete root_;
-    root_ = node;
-    root_->right_ = fake_node_;
-    fake_node_->top_ = root_;
-  } else {
-    node->CleanNodePointers();
-    bool yes = true;
-    while_for_insert(node, yes);
+template <typename Key, typename T, typename Compare, typename Alloc>
+template <typename K, typename>
+typename Map<Key, T, Compare, Alloc>::iterator
+Map<Key, T, Compare, Alloc>::lower_bound(const K &key) {
+  return tree_.LowerBound(key);
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+template <typename K, typename>
+typename Map<Key, T, Compare, Alloc>::const_iterator
+Map<Key, T, Compare, Alloc>::lower_bound(const K &key) const {
+  return tree_.LowerBound(key);
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+template <typename K, typename>
+typename Map<Key, T, Compare, Alloc>::iterator
+Map<Key, T, Compare, Alloc>::upper_bound(const K &key) {
+  return tree_.UpperBound(key);
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+template <typename K, typename>
+typename Map<Key, T, Compare, Alloc>::const_iterator
+Map<Key, T, Compare, Alloc>::upper_bound(const K &key) const {
+  return tree_.UpperBound(key);
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+template <typename K, typename>
+tree::Range<typename Map<Key, T, Compare, Alloc>::const_iterator>
+Map<Key, T, Compare, Alloc>::range(const K &from, const K &to) const {
+  return tree_.RangeOf(from, to);
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+template <typename... Args>
+vector<std::pair<typename Map<Key, T, Compare, Alloc>::iterator, bool>>
+Map<Key, T, Compare, Alloc>::emplace(Args &&...args) {
+  vector<std::pair<iterator, bool>> result = {(insert(args))...};
+  return result;
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+template <typename... Args>
+typename Map<Key, T, Compare, Alloc>::iterator
+Map<Key, T, Compare, Alloc>::emplace_hint(const_iterator hint,
+                                          Args &&...args) {
+  return insert(hint, value_type(std::forward<Args>(args)...));
+}
+
+// Mapped() is the mapped value of the element at pos, which the iterators
+// only show as const
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename Map<Key, T, Compare, Alloc>::mapped_type &
+Map<Key, T, Compare, Alloc>::Mapped(const_iterator pos) const {
+  return tree_type::NodeOf(pos)->value_.second;
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+template <typename K>
+typename Map<Key, T, Compare, Alloc>::const_iterator
+Map<Key, T, Compare, Alloc>::FindOrThrow(const K &key) const {
+  const_iterator found = tree_.Find(key);
+  if (found == end()) {
+    throw std::out_of_range("No such element");
   }
+  return found;
+}
+
+// TryEmplace() builds the element in place only when key is missing, so a
+// present key costs no copy of key or args
+template <typename Key, typename T, typename Compare, typename Alloc>
+template <typename K, typename... Args>
+std::pair<typename Map<Key, T, Compare, Alloc>::iterator, bool>
+Map<Key, T, Compare, Alloc>::TryEmplace(K &&key, Args &&...args) {
+  return tree_.Emplace(key, std::piecewise_construct,
+                       std::forward_as_tuple(std::forward<K>(key)),
+                       std::forward_as_tuple(std::forward<Args>(args)...));
 }
 }  // namespace s21
 
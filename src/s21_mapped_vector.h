@@ -0,0 +1,483 @@
+#ifndef SRC_S21_MAPPED_VECTOR_H_
+#define SRC_S21_MAPPED_VECTOR_H_
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "s21_vector.h"
+
+namespace s21 {
+// open_mode tells mapped_vector how to open its file
+enum class open_mode {
+  read_only,   // an existing file, mapped read-only and shared
+  read_write,  // an existing file, changes are written back to it
+  create       // a new empty file, an existing one is truncated
+};
+
+// mapped_vector is a vector of trivially copyable elements kept in a memory
+// mapped file. The file is the raw array of elements: opening maps it without
+// reading anything, so startup is O(1) and processes opening the same file
+// share its pages. A writable vector grows the file and remaps it with the
+// Growth policy and trims the file to size() when it is closed
+template <typename T, typename Growth = GeometricGrowth<>>
+class mapped_vector {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "mapped_vector needs a trivially copyable element type");
+
+ public:
+  using Iterator = ContiguousIterator<T, mapped_vector>;
+  using ConstIterator = ContiguousIterator<const T, mapped_vector>;
+
+  // Mapped vector Member type
+  using value_type = T;
+  using pointer = value_type *;
+  using const_pointer = const value_type *;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = Iterator;
+  using const_iterator = ConstIterator;
+  using size_type = size_t;
+  using growth_policy = Growth;
+
+  // Mapped vector Member functions
+  mapped_vector() = default;
+  explicit mapped_vector(const std::string &path,
+                         open_mode mode = open_mode::read_only);
+  mapped_vector(const mapped_vector &other) = delete;
+  mapped_vector(mapped_vector &&other) noexcept;
+  ~mapped_vector();
+  mapped_vector &operator=(const mapped_vector &other) = delete;
+  mapped_vector &operator=(mapped_vector &&other) noexcept;
+
+  // Mapped vector File
+  // open() maps the file at path, an open file is closed first
+  void open(const std::string &path, open_mode mode = open_mode::read_only);
+  // close() unmaps the file and trims a writable one to size() elements
+  void close() noexcept;
+  // is_open() checks whether a file is mapped
+  bool is_open() const;
+  // is_read_only() checks whether the file was opened read-only
+  bool is_read_only() const;
+  // sync() flushes the changes to the file, it blocks until they are written
+  void sync();
+
+  // Mapped vector Element access
+  // at() access specified element with bounds checking
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  // operator[] access specified element
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  // front() access the first element
+  reference front();
+  const_reference front() const;
+  // back() access the last element
+  reference back();
+  const_reference back() const;
+  // data() direct access to the mapping, it must not be written through when
+  // the file is read-only
+  pointer data();
+  const_pointer data() const;
+
+  // Mapped vector Iterators
+  // begin() returns an iterator to the beginning
+  iterator begin();
+  const_iterator begin() const;
+  // end() returns an iterator to the end
+  iterator end();
+  const_iterator end() const;
+
+  // Mapped vector Capacity
+  // empty() checks whether the container is empty
+  bool empty() const;
+  // size() returns the number of elements
+  size_type size() const;
+  // max_size() returns the maximum possible number of elements
+  size_type max_size() const;
+  // reserve() grows the file to n elements and remaps it
+  void reserve(size_type n);
+  // capacity() returns the number of elements the file has room for
+  size_type capacity() const;
+  // shrink_to_fit() trims the file to size() elements and remaps it
+  void shrink_to_fit();
+
+  // Mapped vector Modifiers
+  // clear() clears the contents, the file keeps its capacity
+  void clear();
+  // insert() inserts value before pos and returns an iterator to it
+  iterator insert(iterator pos, const_reference value);
+  // erase() erases element at pos and returns the iterator following it
+  iterator erase(iterator pos);
+  // push_back() adds an element to the end
+  void push_back(const_reference value);
+  // pop_back() removes the last element
+  void pop_back();
+  // swap() swaps the mapped files
+  void swap(mapped_vector &other) noexcept;
+
+ private:
+  int fd_ = -1;
+  open_mode mode_ = open_mode::read_only;
+  pointer data_ = nullptr;
+  size_type size_ = 0;
+  size_type cap_ = 0;
+
+  // Mapped vector Helper Methods
+  size_type GrowCapacity(size_type required) const;
+  void Remap(size_type new_cap);
+  pointer MapFile(size_type count) const;
+  void ResizeFile(size_type count);
+  void CheckWritable() const;
+  // error is errno unless a cleanup call could have overwritten it since
+  [[noreturn]] static void ThrowSystemError(const std::string &what,
+                                            int error = errno);
+};
+
+template <typename T, typename Growth>
+mapped_vector<T, Growth>::mapped_vector(const std::string &path,
+                                        open_mode mode) {
+  open(path, mode);
+}
+
+template <typename T, typename Growth>
+mapped_vector<T, Growth>::mapped_vector(mapped_vector &&other) noexcept {
+  swap(other);
+}
+
+template <typename T, typename Growth>
+mapped_vector<T, Growth>::~mapped_vector() {
+  close();
+}
+
+template <typename T, typename Growth>
+mapped_vector<T, Growth> &mapped_vector<T, Growth>::operator=(
+    mapped_vector &&other) noexcept {
+  if (this != &other) {
+    close();
+    swap(other);
+  }
+  return *this;
+}
+
+template <typename T, typename Growth>
+void mapped_vector<T, Growth>::open(const std::string &path, open_mode mode) {
+  close();
+  int flags = O_RDWR;
+  if (mode == open_mode::read_only) flags = O_RDONLY;
+  if (mode == open_mode::create) flags = O_RDWR | O_CREAT | O_TRUNC;
+  int fd = ::open(path.c_str(), flags, 0644);
+  if (fd < 0) ThrowSystemError("Cannot open " + path);
+  struct stat info;
+  if (fstat(fd, &info) != 0) {
+    int error = errno;
+    ::close(fd);
+    ThrowSystemError("Cannot stat " + path, error);
+  }
+  size_type bytes = static_cast<size_type>(info.st_size);
+  if (bytes % sizeof(T) != 0) {
+    ::close(fd);
+    throw std::runtime_error(path + " holds a partial element");
+  }
+  fd_ = fd;
+  mode_ = mode;
+  try {
+    data_ = MapFile(bytes / sizeof(T));
+  } catch (...) {
+    ::close(fd_);
+    fd_ = -1;
+    throw;
+  }
+  size_ = cap_ = bytes / sizeof(T);
+}
+
+template <typename T, typename Growth>
+void mapped_vector<T, Growth>::close() noexcept {
+  if (fd_ < 0) return;
+  if (data_) munmap(data_, cap_ * sizeof(T));
+  if (!is_read_only() && cap_ != size_) {
+    // the vector cannot report an error from here, call sync() or
+    // shrink_to_fit() first to see it
+    static_cast<void>(ftruncate(fd_, size_ * sizeof(T)));
+  }
+  ::close(fd_);
+  fd_ = -1;
+  data_ = nullptr;
+  size_ = cap_ = 0;
+}
+
+template <typename T, typename Growth>
+bool mapped_vector<T, Growth>::is_open() const {
+  return fd_ >= 0;
+}
+
+template <typename T, typename Growth>
+bool mapped_vector<T, Growth>::is_read_only() const {
+  return mode_ == open_mode::read_only;
+}
+
+template <typename T, typename Growth>
+void mapped_vector<T, Growth>::sync() {
+  if (data_ && !is_read_only() &&
+      msync(data_, cap_ * sizeof(T), MS_SYNC) != 0) {
+    ThrowSystemError("Cannot sync the mapped file");
+  }
+}
+
+template <typename T, typename Growth>
+typename mapped_vector<T, Growth>::reference mapped_vector<T, Growth>::at(
+    size_type pos) {
+  if (pos >= size_) {
+    throw std::out_of_range("Position is out_of_range\n");
+  }
+  return data_[pos];
+}
+
+template <typename T, typename Growth>
+typename mapped_vector<T, Growth>::const_reference
+mapped_vector<T, Growth>::at(size_type pos) const {
+  if (pos >= size_) {
+    throw std::out_of_range("Position is out_of_range\n");
+  }
+  return data_[pos];
+}
+
+template <typename T, typename Growth>
+typename mapped_vector<T, Growth>::reference
+mapped_vector<T, Growth>::operator[](size_type pos) {
+  return data_[pos];
+}
+
+template <typename T, typename Growth>
+typename mapped_vector<T, Growth>::const_reference
+mapped_vector<T, Growth>::operator[](size_type pos) const {
+  return data_[pos];
+}
+
+template <typename T, typename Growth>
+typename mapped_vector<T, Growth>::reference
+mapped_vector<T, Growth>::front() {
+  return data_[0];
+}
+
+template <typename T, typename Growth>
+typename mapped_vector<T, Growth>::const_reference
+mapped_vector<T, Growth>::front() const {
+  return data_[0];
+}
+
+template <typename T, typename Growth>
+typename mapped_vector<T, Growth>::reference mapped_vector<T, Growth>::back() {
+  return data_[size_ - 1];
+}
+
+template <typename T, typename Growth>
+typename mapped_vector<T, Growth>::const_reference
+mapped_vector<T, Growth>::back() const {
+  return data_[size_ - 1];
+}
+
+template <typename T, typename Growth>
+typename mapped_vector<T, Growth>::pointer mapped_vector<T, Growth>::data() {
+  return data_;
+}
+
+template <typename T, typename Growth>
+typename mapped_vector<T, Growth>::const_pointer
+mapped_vector<T, Growth>::data() const {
+  return data_;
+}
+
+template <typename T, typename Growth>
+typename mapped_vector<T, Growth>::iterator mapped_vector<T, Growth>::begin() {
+  return iterator(data_);
+}
+
+template <typename T, typename Growth>
+typename mapped_vector<T, Growth>::const_iterator
+mapped_vector<T, Growth>::begin() const {
+  return const_iterator(data_);
+}
+
+template <typename T, typename Growth>
+typename mapped_vector<T, Growth>::iterator mapped_vector<T, Growth>::end() {
+  return iterator(data_ + size_);
+}
+
+template <typename T, typename Growth>
+typename mapped_vector<T, Growth>::const_iterator
+mapped_vector<T, Growth>::end() const {
+  return const_iterator(data_ + size_);
+}
+
+template <typename T, typename Growth>
+bool mapped_vector<T, Growth>::empty() const {
+  return size_ == 0;
+}
+
+template <typename T, typename Growth>
+typename mapped_vector<T, Growth>::size_type mapped_vector<T, Growth>::size()
+    const {
+  return size_;
+}
+
+template <typename T, typename Growth>
+typename mapped_vector<T, Growth>::size_type
+mapped_vector<T, Growth>::max_size() const {
+  return static_cast<size_type>(std::numeric_limits<off_t>::max()) /
+         sizeof(T);
+}
+
+template <typename T, typename Growth>
+void mapped_vector<T, Growth>::reserve(size_type n) {
+  CheckWritable();
+  if (n > max_size()) {
+    throw std::length_error("Cannot reserve more than max_size()");
+  }
+  if (n > cap_) Remap(n);
+}
+
+template <typename T, typename Growth>
+typename mapped_vector<T, Growth>::size_type
+mapped_vector<T, Growth>::capacity() const {
+  return cap_;
+}
+
+template <typename T, typename Growth>
+void mapped_vector<T, Growth>::shrink_to_fit() {
+  CheckWritable();
+  if (cap_ > size_) Remap(size_);
+}
+
+template <typename T, typename Growth>
+void mapped_vector<T, Growth>::clear() {
+  CheckWritable();
+  size_ = 0;
+}
+
+template <typename T, typename Growth>
+typename mapped_vector<T, Growth>::iterator mapped_vector<T, Growth>::insert(
+    iterator pos, const_reference value) {
+  CheckWritable();
+  size_type index = pos.base() - data_;
+  // value may live in the mapping that is about to move
+  value_type copy = value;
+  if (size_ == cap_) Remap(GrowCapacity(size_ + 1));
+  std::memmove(static_cast<void *>(data_ + index + 1),
+               static_cast<const void *>(data_ + index),
+               (size_ - index) * sizeof(T));
+  data_[index] = copy;
+  ++size_;
+  return iterator(data_ + index);
+}
+
+template <typename T, typename Growth>
+typename mapped_vector<T, Growth>::iterator mapped_vector<T, Growth>::erase(
+    iterator pos) {
+  CheckWritable();
+  if (pos == end()) {
+    throw std::logic_error(
+        "The end() iterator cannot be used as a value for pos\n");
+  }
+  size_type index = pos.base() - data_;
+  std::memmove(static_cast<void *>(data_ + index),
+               static_cast<const void *>(data_ + index + 1),
+               (size_ - index - 1) * sizeof(T));
+  --size_;
+  return iterator(data_ + index);
+}
+
+template <typename T, typename Growth>
+void mapped_vector<T, Growth>::push_back(const_reference value) {
+  insert(end(), value);
+}
+
+template <typename T, typename Growth>
+void mapped_vector<T, Growth>::pop_back() {
+  CheckWritable();
+  if (size_ > 0) --size_;
+}
+
+template <typename T, typename Growth>
+void mapped_vector<T, Growth>::swap(mapped_vector &other) noexcept {
+  std::swap(fd_, other.fd_);
+  std::swap(mode_, other.mode_);
+  std::swap(data_, other.data_);
+  std::swap(size_, other.size_);
+  std::swap(cap_, other.cap_);
+}
+
+// Mapped vector Helper Methods
+
+// GrowCapacity() returns the capacity the Growth policy gives for required
+// elements, clamped to max_size() so the size of the file cannot overflow
+template <typename T, typename Growth>
+typename mapped_vector<T, Growth>::size_type
+mapped_vector<T, Growth>::GrowCapacity(size_type required) const {
+  if (required > max_size()) {
+    throw std::length_error("Cannot grow mapped_vector beyond max_size()");
+  }
+  size_type result = Growth::NextCapacity(cap_, required);
+  return result > max_size() || result < cap_ ? max_size() : result;
+}
+
+// Remap() resizes the file to new_cap elements and maps it again. The file
+// grows before the new mapping is made, and back if that fails, and shrinks
+// after the old one is gone, so a failure leaves the vector as it was
+template <typename T, typename Growth>
+void mapped_vector<T, Growth>::Remap(size_type new_cap) {
+  bool shrinks = new_cap < cap_;
+  if (!shrinks) ResizeFile(new_cap);
+  pointer mapped;
+  try {
+    mapped = MapFile(new_cap);
+  } catch (...) {
+    // the error to report is the one of mmap
+    if (!shrinks) static_cast<void>(ftruncate(fd_, cap_ * sizeof(T)));
+    throw;
+  }
+  if (data_) munmap(data_, cap_ * sizeof(T));
+  data_ = mapped;
+  cap_ = new_cap;
+  if (shrinks) ResizeFile(new_cap);
+}
+
+// MapFile() maps the first count elements of the file, an empty file has no
+// mapping
+template <typename T, typename Growth>
+typename mapped_vector<T, Growth>::pointer mapped_vector<T, Growth>::MapFile(
+    size_type count) const {
+  if (count == 0) return nullptr;
+  int protection = is_read_only() ? PROT_READ : PROT_READ | PROT_WRITE;
+  void *mapped =
+      mmap(nullptr, count * sizeof(T), protection, MAP_SHARED, fd_, 0);
+  if (mapped == MAP_FAILED) ThrowSystemError("Cannot map the file");
+  return static_cast<pointer>(mapped);
+}
+
+template <typename T, typename Growth>
+void mapped_vector<T, Growth>::ResizeFile(size_type count) {
+  if (ftruncate(fd_, static_cast<off_t>(count * sizeof(T))) != 0) {
+    ThrowSystemError("Cannot resize the mapped file");
+  }
+}
+
+template <typename T, typename Growth>
+void mapped_vector<T, Growth>::CheckWritable() const {
+  if (!is_open()) {
+    throw std::logic_error("mapped_vector has no open file");
+  }
+  if (is_read_only()) {
+    throw std::logic_error("mapped_vector is opened read-only");
+  }
+}
+
+template <typename T, typename Growth>
+void mapped_vector<T, Growth>::ThrowSystemError(const std::string &what,
+                                                int error) {
+  throw std::system_error(error, std::generic_category(), what);
+}
+}  // namespace s21
+
+#endif  // SRC_S21_MAPPED_VECTOR_H_
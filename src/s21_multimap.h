@@ -0,0 +1,618 @@
+#ifndef SRC_S21_MULTIMAP_H_
+#define SRC_S21_MULTIMAP_H_
+
+#include "s21_rb_tree.h"
+
+namespace s21 {
+// multimap keeps any number of elements per key, each in its own node, in
+// the order they were inserted among equal keys
+template <typename Key, typename T, typename Compare = std::less<Key>,
+          typename Alloc = std::allocator<std::pair<const Key, T>>>
+class multimap {
+ public:
+  // Multimap Member type
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using node = tree::Node<value_type>;
+  using iterator = tree::Iterator<node, false>;
+  using const_iterator = tree::Iterator<node>;
+  using size_type = size_t;
+  using pointer_to_node = node *;
+  using key_compare = Compare;
+  using allocator_type = Alloc;
+
+  // node_type owns an element taken out of the multimap by extract(). Its key
+  // can be changed before the node is inserted again: key() hands out a copy
+  // of the key, which is const in the node, and insert() rebuilds the node
+  // around it
+  class node_type : public tree::NodeHandle<node, Alloc> {
+    friend class multimap;
+    using node_handle = tree::NodeHandle<node, Alloc>;
+
+   public:
+    using key_type = Key;
+    using mapped_type = T;
+
+    node_type() = default;
+    key_type &key() const;
+    mapped_type &mapped() const;
+    void swap(node_type &other);
+
+   private:
+    node_type(pointer_to_node node,
+              const typename node_handle::node_allocator &alloc);
+    // Rekey() moves the key handed out by key() into a new node, which
+    // replaces the old one
+    void Rekey();
+
+    mutable std::optional<key_type> key_;
+  };
+
+  // Multimap Member functions
+  multimap();
+  explicit multimap(const Compare &comp,
+                    const allocator_type &alloc = allocator_type());
+  explicit multimap(const allocator_type &alloc);
+  multimap(std::initializer_list<value_type> const &items);
+  // Builds a multimap from a range, in O(n) when it is sorted by key. The
+  // tagged constructor trusts the order of the keys instead of checking it
+  template <typename InputIt, typename = typename std::iterator_traits<
+                                  InputIt>::iterator_category>
+  multimap(InputIt first, InputIt last, const Compare &comp = Compare());
+  template <typename InputIt>
+  multimap(assume_sorted_t, InputIt first, InputIt last,
+           const Compare &comp = Compare());
+  multimap(const multimap &other);
+  multimap(multimap &&other);
+  ~multimap();
+  multimap &operator=(const multimap &other);
+  multimap &operator=(multimap &&other);
+  // Returns the allocator the nodes are allocated with
+  allocator_type get_allocator() const;
+  // Returns the function that orders the keys
+  key_compare key_comp() const;
+
+  // Multimap Iterators
+  // Returns an iterator to the beginning
+  iterator begin();
+  const_iterator begin() const;
+  // Returns an iterator to the end
+  iterator end();
+  const_iterator end() const;
+
+  // Multimap Capacity
+  // Checks whether the container is empty
+  bool empty() const;
+  // Returns the number of elements
+  size_type size() const;
+  // Returns the maximum possible number of elements
+  size_type max_size() const;
+
+  // Multimap Modifiers
+  // Clears the contents
+  void clear();
+  // Inserts value after the elements with an equivalent key and returns an
+  // iterator to it
+  iterator insert(const value_type &value);
+  iterator insert(const Key &key, const T &obj);
+  // Inserts value as close as possible before hint, in amortized O(1) when
+  // that keeps the order
+  iterator insert(const_iterator hint, const value_type &value);
+  // Inserts a range, in O(n) when the multimap is empty and the range is
+  // sorted by key
+  template <typename InputIt, typename = typename std::iterator_traits<
+                                  InputIt>::iterator_category>
+  void insert(InputIt first, InputIt last);
+  // Links an extracted node, allocating nothing when the allocators compare
+  // equal
+  iterator insert(node_type &&handle);
+  iterator insert(const_iterator hint, node_type &&handle);
+  // Erases element at pos
+  void erase(iterator pos);
+  void erase(const_iterator pos);
+  // Unlinks an element, the first one with an equivalent key for
+  // extract(key), and hands its node over without freeing it
+  node_type extract(const_iterator pos);
+  node_type extract(const key_type &key);
+  // Swaps the contents
+  void swap(multimap &other);
+  // Splices nodes from another container
+  void merge(multimap &other);
+
+  // Multimap Lookup
+  // Returns the number of elements with key equivalent to key
+  size_type count(const Key &key) const;
+  // Finds the first element with key equivalent to key
+  iterator find(const Key &key);
+  const_iterator find(const Key &key) const;
+  // Checks if there is an element with key equivalent to key in the container
+  bool contains(const Key &key) const;
+  // Returns the range of elements with key equivalent to key
+  std::pair<iterator, iterator> equal_range(const Key &key);
+  std::pair<const_iterator, const_iterator> equal_range(const Key &key) const;
+  // Returns an iterator to the first element with key not less than key
+  iterator lower_bound(const Key &key);
+  const_iterator lower_bound(const Key &key) const;
+  // Returns an iterator to the first element with key greater than key
+  iterator upper_bound(const Key &key);
+  const_iterator upper_bound(const Key &key) const;
+  // Returns a view of the elements with keys in [from, to), empty unless from
+  // is less than to, in O(log n)
+  tree::Range<const_iterator> range(const Key &from, const Key &to) const;
+  // With a transparent Compare the lookups take any type it can compare with
+  // a key, without building a key_type
+  template <typename K, typename = tree::IfTransparent<Compare, K>>
+  size_type count(const K &key) const;
+  template <typename K, typename = tree::IfTransparent<Compare, K>>
+  iterator find(const K &key);
+  template <typename K, typename = tree::IfTransparent<Compare, K>>
+  const_iterator find(const K &key) const;
+  template <typename K, typename = tree::IfTransparent<Compare, K>>
+  bool contains(const K &key) const;
+  template <typename K, typename = tree::IfTransparent<Compare, K>>
+  std::pair<iterator, iterator> equal_range(const K &key);
+  template <typename K, typename = tree::IfTransparent<Compare, K>>
+  std::pair<const_iterator, const_iterator> equal_range(const K &key) const;
+  template <typename K, typename = tree::IfTransparent<Compare, K>>
+  iterator lower_bound(const K &key);
+  template <typename K, typename = tree::IfTransparent<Compare, K>>
+  const_iterator lower_bound(const K &key) const;
+  template <typename K, typename = tree::IfTransparent<Compare, K>>
+  iterator upper_bound(const K &key);
+  template <typename K, typename = tree::IfTransparent<Compare, K>>
+  const_iterator upper_bound(const K &key) const;
+  template <typename K, typename = tree::IfTransparent<Compare, K>>
+  tree::Range<const_iterator> range(const K &from, const K &to) const;
+
+  // Multimap Emplace
+  // emplace() constructs an element from args in its node and inserts it
+  // after the elements with an equivalent key
+  template <typename... Args>
+  iterator emplace(Args &&...args);
+  // emplace_hint() constructs an element and inserts it like insert(hint)
+  template <typename... Args>
+  iterator emplace_hint(const_iterator hint, Args &&...args);
+
+ private:
+  using tree_type = tree::RbTree<node, tree::First, Compare, Alloc, false>;
+
+  // Mutable() is the mutable iterator to the element the tree points to
+  static iterator Mutable(const_iterator pos);
+  static std::pair<iterator, iterator> Mutable(
+      std::pair<const_iterator, const_iterator> range);
+
+  tree_type tree_;
+};
+
+// node_type class implementation
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+multimap<Key, T, Compare, Alloc>::node_type::node_type(
+    pointer_to_node node, const typename node_handle::node_allocator &alloc)
+    : node_handle(node, alloc) {}
+
+// key() is the one place the key of an element is not const, as with the node
+// handles of std::multimap
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename multimap<Key, T, Compare, Alloc>::key_type &
+multimap<Key, T, Compare, Alloc>::node_type::key() const {
+  if (!key_) key_.emplace(this->node_->value_.first);
+  return *key_;
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename multimap<Key, T, Compare, Alloc>::mapped_type &
+multimap<Key, T, Compare, Alloc>::node_type::mapped() const {
+  return this->node_->value_.second;
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+void multimap<Key, T, Compare, Alloc>::node_type::swap(node_type &other) {
+  node_handle::swap(other);
+  key_.swap(other.key_);
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+void multimap<Key, T, Compare, Alloc>::node_type::Rekey() {
+  if (!key_) return;
+  if (this->node_) {
+    using node_traits = typename node_handle::node_traits;
+    auto &alloc = *this->alloc_;
+    pointer_to_node fresh = node_traits::allocate(alloc, 1);
+    try {
+      node_traits::construct(alloc, fresh, std::in_place, std::move(*key_),
+                             std::move(this->node_->value_.second));
+    } catch (...) {
+      node_traits::deallocate(alloc, fresh, 1);
+      throw;
+    }
+    node_traits::destroy(alloc, this->node_);
+    node_traits::deallocate(alloc, this->node_, 1);
+    this->node_ = fresh;
+  }
+  key_.reset();
+}
+
+// Multimap class implementation
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+multimap<Key, T, Compare, Alloc>::multimap() : multimap(Compare()) {}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+multimap<Key, T, Compare, Alloc>::multimap(const Compare &comp,
+                                           const allocator_type &alloc)
+    : tree_(comp, typename tree_type::node_allocator(alloc)) {}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+multimap<Key, T, Compare, Alloc>::multimap(const allocator_type &alloc)
+    : multimap(Compare(), alloc) {}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+multimap<Key, T, Compare, Alloc>::multimap(
+    std::initializer_list<value_type> const &items)
+    : multimap() {
+  tree_.InsertRange(items.begin(), items.end(), true, false);
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+template <typename InputIt, typename>
+multimap<Key, T, Compare, Alloc>::multimap(InputIt first, InputIt last,
+                                           const Compare &comp)
+    : multimap(comp) {
+  tree_.InsertRange(first, last, true, false);
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+template <typename InputIt>
+multimap<Key, T, Compare, Alloc>::multimap(assume_sorted_t, InputIt first,
+                                           InputIt last, const Compare &comp)
+    : multimap(comp) {
+  tree_.InsertRange(first, last, false, false);
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+multimap<Key, T, Compare, Alloc>::multimap(const multimap &other)
+    : tree_(other.tree_) {}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+multimap<Key, T, Compare, Alloc>::multimap(multimap &&other)
+    : tree_(std::move(other.tree_)) {}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+multimap<Key, T, Compare, Alloc>::~multimap() = default;
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+multimap<Key, T, Compare, Alloc> &multimap<Key, T, Compare, Alloc>::operator=(
+    const multimap &other) {
+  if (this != &other) {
+    multimap temp(other);
+    swap(temp);
+  }
+  return *this;
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+multimap<Key, T, Compare, Alloc> &multimap<Key, T, Compare, Alloc>::operator=(
+    multimap &&other) {
+  if (this != &other) {
+    multimap temp(std::move(other));
+    swap(temp);
+  }
+  return *this;
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename multimap<Key, T, Compare, Alloc>::allocator_type
+multimap<Key, T, Compare, Alloc>::get_allocator() const {
+  return allocator_type(tree_.GetAllocator());
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename multimap<Key, T, Compare, Alloc>::key_compare
+multimap<Key, T, Compare, Alloc>::key_comp() const {
+  return tree_.KeyComp();
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename multimap<Key, T, Compare, Alloc>::iterator
+multimap<Key, T, Compare, Alloc>::begin() {
+  return Mutable(tree_.Begin());
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename multimap<Key, T, Compare, Alloc>::const_iterator
+multimap<Key, T, Compare, Alloc>::begin() const {
+  return tree_.Begin();
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename multimap<Key, T, Compare, Alloc>::iterator
+multimap<Key, T, Compare, Alloc>::end() {
+  return Mutable(tree_.End());
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename multimap<Key, T, Compare, Alloc>::const_iterator
+multimap<Key, T, Compare, Alloc>::end() const {
+  return tree_.End();
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+bool multimap<Key, T, Compare, Alloc>::empty() const {
+  return tree_.Size() == 0;
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename multimap<Key, T, Compare, Alloc>::size_type
+multimap<Key, T, Compare, Alloc>::size() const {
+  return tree_.Size();
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename multimap<Key, T, Compare, Alloc>::size_type
+multimap<Key, T, Compare, Alloc>::max_size() const {
+  std::allocator<std::pair<Key, T>> alloc;
+  return alloc.max_size() / 5;
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+void multimap<Key, T, Compare, Alloc>::clear() {
+  tree_.Clear();
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename multimap<Key, T, Compare, Alloc>::iterator
+multimap<Key, T, Compare, Alloc>::insert(const value_type &value) {
+  return Mutable(tree_.Emplace(value.first, value).first);
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename multimap<Key, T, Compare, Alloc>::iterator
+multimap<Key, T, Compare, Alloc>::insert(const key_type &key,
+                                         const mapped_type &obj) {
+  return Mutable(tree_.Emplace(key, key, obj).first);
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename multimap<Key, T, Compare, Alloc>::iterator
+multimap<Key, T, Compare, Alloc>::insert(const_iterator hint,
+                                         const value_type &value) {
+  return Mutable(tree_.EmplaceHint(hint, value.first, value).first);
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+template <typename InputIt, typename>
+void multimap<Key, T, Compare, Alloc>::insert(InputIt first, InputIt last) {
+  tree_.InsertRange(first, last, true, false);
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename multimap<Key, T, Compare, Alloc>::iterator
+multimap<Key, T, Compare, Alloc>::insert(node_type &&handle) {
+  handle.Rekey();
+  return Mutable(tree_.Reinsert(handle).first);
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename multimap<Key, T, Compare, Alloc>::iterator
+multimap<Key, T, Compare, Alloc>::insert(const_iterator hint,
+                                         node_type &&handle) {
+  handle.Rekey();
+  return Mutable(tree_.Reinsert(hint, handle).first);
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+void multimap<Key, T, Compare, Alloc>::erase(iterator pos) {
+  tree_.Erase(pos);
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+void multimap<Key, T, Compare, Alloc>::erase(const_iterator pos) {
+  tree_.Erase(pos);
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename multimap<Key, T, Compare, Alloc>::node_type
+multimap<Key, T, Compare, Alloc>::extract(const_iterator pos) {
+  return node_type(tree_.Extract(pos), tree_.GetAllocator());
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename multimap<Key, T, Compare, Alloc>::node_type
+multimap<Key, T, Compare, Alloc>::extract(const key_type &key) {
+  iterator found = find(key);
+  if (found == end()) return node_type();
+  return extract(found);
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+void multimap<Key, T, Compare, Alloc>::swap(multimap &other) {
+  tree_.Swap(other.tree_);
+}
+
+// merge() relinks every node of other into this tree
+template <typename Key, typename T, typename Compare, typename Alloc>
+void multimap<Key, T, Compare, Alloc>::merge(multimap &other) {
+  tree_.Merge(other.tree_);
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename multimap<Key, T, Compare, Alloc>::size_type
+multimap<Key, T, Compare, Alloc>::count(const Key &key) const {
+  return tree_.Count(key);
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename multimap<Key, T, Compare, Alloc>::iterator
+multimap<Key, T, Compare, Alloc>::find(const Key &key) {
+  return Mutable(tree_.Find(key));
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename multimap<Key, T, Compare, Alloc>::const_iterator
+multimap<Key, T, Compare, Alloc>::find(const Key &key) const {
+  return tree_.Find(key);
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+bool multimap<Key, T, Compare, Alloc>::contains(const Key &key) const {
+  return tree_.Find(key) != tree_.End();
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+std::pair<typename multimap<Key, T, Compare, Alloc>::iterator,
+          typename multimap<Key, T, Compare, Alloc>::iterator>
+multimap<Key, T, Compare, Alloc>::equal_range(const Key &key) {
+  return Mutable(tree_.EqualRange(key));
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+std::pair<typename multimap<Key, T, Compare, Alloc>::const_iterator,
+          typename multimap<Key, T, Compare, Alloc>::const_iterator>
+multimap<Key, T, Compare, Alloc>::equal_range(const Key &key) const {
+  return tree_.EqualRange(key);
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename multimap<Key, T, Compare, Alloc>::iterator
+multimap<Key, T, Compare, Alloc>::lower_bound(const Key &key) {
+  return Mutable(tree_.LowerBound(key));
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename multimap<Key, T, Compare, Alloc>::const_iterator
+multimap<Key, T, Compare, Alloc>::lower_bound(const Key &key) const {
+  return tree_.LowerBound(key);
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename multimap<Key, T, Compare, Alloc>::iterator
+multimap<Key, T, Compare, Alloc>::upper_bound(const Key &key) {
+  return Mutable(tree_.UpperBound(key));
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename multimap<Key, T, Compare, Alloc>::const_iterator
+multimap<Key, T, Compare, Alloc>::upper_bound(const Key &key) const {
+  return tree_.UpperBound(key);
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+tree::Range<typename multimap<Key, T, Compare, Alloc>::const_iterator>
+multimap<Key, T, Compare, Alloc>::range(const Key &from, const Key &to) const {
+  return tree_.RangeOf(from, to);
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+template <typename K, typename>
+typename multimap<Key, T, Compare, Alloc>::size_type
+multimap<Key, T, Compare, Alloc>::count(const K &key) const {
+  return tree_.Count(key);
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+template <typename K, typename>
+typename multimap<Key, T, Compare, Alloc>::iterator
+multimap<Key, T, Compare, Alloc>::find(const K &key) {
+  return Mutable(tree_.Find(key));
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+template <typename K, typename>
+typename multimap<Key, T, Compare, Alloc>::const_iterator
+multimap<Key, T, Compare, Alloc>::find(const K &key) const {
+  return tree_.Find(key);
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+template <typename K, typename>
+bool multimap<Key, T, Compare, Alloc>::contains(const K &key) const {
+  return tree_.Find(key) != tree_.End();
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+template <typename K, typename>
+std::pair<typename multimap<Key, T, Compare, Alloc>::iterator,
+          typename multimap<Key, T, Compare, Alloc>::iterator>
+multimap<Key, T, Compare, Alloc>::equal_range(const K &key) {
+  return Mutable(tree_.EqualRange(key));
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+template <typename K, typename>
+std::pair<typename multimap<Key, T, Compare, Alloc>::const_iterator,
+          typename multimap<Key, T, Compare, Alloc>::const_iterator>
+multimap<Key, T, Compare, Alloc>::equal_range(const K &key) const {
+  return tree_.EqualRange(key);
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+template <typename K, typename>
+typename multimap<Key, T, Compare, Alloc>::iterator
+multimap<Key, T, Compare, Alloc>::lower_bound(const K &key) {
+  return Mutable(tree_.LowerBound(key));
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+template <typename K, typename>
+typename multimap<Key, T, Compare, Alloc>::const_iterator
+multimap<Key, T, Compare, Alloc>::lower_bound(const K &key) const {
+  return tree_.LowerBound(key);
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+template <typename K, typename>
+typename multimap<Key, T, Compare, Alloc>::iterator
+multimap<Key, T, Compare, Alloc>::upper_bound(const K &key) {
+  return Mutable(tree_.UpperBound(key));
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+template <typename K, typename>
+typename multimap<Key, T, Compare, Alloc>::const_iterator
+multimap<Key, T, Compare, Alloc>::upper_bound(const K &key) const {
+  return tree_.UpperBound(key);
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+template <typename K, typename>
+tree::Range<typename multimap<Key, T, Compare, Alloc>::const_iterator>
+multimap<Key, T, Compare, Alloc>::range(const K &from, const K &to) const {
+  return tree_.RangeOf(from, to);
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+typename multimap<Key, T, Compare, Alloc>::iterator
+multimap<Key, T, Compare, Alloc>::Mutable(const_iterator pos) {
+  return iterator(tree_type::NodeOf(pos));
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+std::pair<typename multimap<Key, T, Compare, Alloc>::iterator,
+          typename multimap<Key, T, Compare, Alloc>::iterator>
+multimap<Key, T, Compare, Alloc>::Mutable(
+    std::pair<const_iterator, const_iterator> range) {
+  return {Mutable(range.first), Mutable(range.second)};
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+template <typename... Args>
+typename multimap<Key, T, Compare, Alloc>::iterator
+multimap<Key, T, Compare, Alloc>::emplace(Args &&...args) {
+  return Mutable(tree_.EmplaceValue(std::forward<Args>(args)...).first);
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+template <typename... Args>
+typename multimap<Key, T, Compare, Alloc>::iterator
+multimap<Key, T, Compare, Alloc>::emplace_hint(const_iterator hint,
+                                               Args &&...args) {
+  return Mutable(
+      tree_.EmplaceValueHint(hint, std::forward<Args>(args)...).first);
+}
+}  // namespace s21
+
+#endif  // SRC_S21_MULTIMAP_H_
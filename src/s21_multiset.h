@@ -1,60 +1,87 @@
 #ifndef SRC_S21_MULTISET_H_
 #define SRC_S21_MULTISET_H_
 
+#include "s21_rb_tree.h"
 #include "s21_vector.h"
 
 namespace s21 {
-template <typename Key>
+// multiset_options are the flags of the last template parameter of multiset.
+// With kRanked every node also keeps the number of elements in its subtree,
+// which makes the order statistics nth(), rank(), count_less() and count()
+// O(log n) at the price of a walk up to the root on every insert and erase.
+// With kRunLength equal elements share one node that counts them, so memory
+// grows with the number of distinct keys; the elements equal to a stored one
+// are copies of it, and erasing one of them invalidates iterators to the last
+// one
+struct multiset_options {
+  static constexpr unsigned kRanked = 1;
+  static constexpr unsigned kRunLength = 2;
+};
+
+template <typename Key, typename Compare = std::less<Key>,
+          typename Alloc = std::allocator<Key>, unsigned kOptions = 0>
 class multiset {
-  class BinaryTreeNode;
+  static constexpr bool kRanked = (kOptions & multiset_options::kRanked) != 0;
+  static constexpr bool kRunLength =
+      (kOptions & multiset_options::kRunLength) != 0;
 
  public:
   // Multiset Member type
-  class TreeIterator;
   using key_type = Key;
   using value_type = Key;
-  using node = BinaryTreeNode;
-  using iterator = TreeIterator;
-  using const_iterator = TreeIterator;
-  using pointer_to_node = BinaryTreeNode*;
+  using node = tree::Node<Key, kRanked, kRunLength>;
+  using iterator = tree::Iterator<node>;
+  using const_iterator = iterator;
+  using pointer_to_node = node*;
   using reference = value_type&;
   using const_reference = const value_type&;
   using size_type = size_t;
+  using key_compare = Compare;
+  using value_compare = Compare;
+  using allocator_type = Alloc;
 
-  // Public class of Iterator
-  class TreeIterator {
+  // node_type owns an element taken out of the multiset by extract()
+  class node_type : public tree::NodeHandle<node, Alloc> {
     friend class multiset;
+    using node_handle = tree::NodeHandle<node, Alloc>;
 
    public:
     using value_type = Key;
-    using pointer_to_node = BinaryTreeNode*;
-    using const_reference = const value_type&;
 
-   public:
-    TreeIterator();
-    explicit TreeIterator(pointer_to_node ptr);
-    TreeIterator& operator++();
-    TreeIterator operator++(int);
-    TreeIterator& operator--();
-    TreeIterator operator--(int);
-    const_reference operator*() const;
-    bool operator==(const TreeIterator& other);
-    bool operator!=(const TreeIterator& other);
+    node_type() = default;
+    value_type& value() const;
 
    private:
-    pointer_to_node ptr_;
+    node_type(pointer_to_node node,
+              const typename node_handle::node_allocator& alloc);
   };
 
   // Multiset Member functions
  public:
   multiset();
+  explicit multiset(const Compare& comp,
+                    const allocator_type& alloc = allocator_type());
+  explicit multiset(const allocator_type& alloc);
   multiset(std::initializer_list<value_type> const& items);
+  // a sorted range is built in O(n); the tagged constructor trusts the order
+  // of the range instead of checking it
+  template <typename InputIt, typename = typename std::iterator_traits<
+                                  InputIt>::iterator_category>
+  multiset(InputIt first, InputIt last, const Compare& comp = Compare());
+  template <typename InputIt>
+  multiset(assume_sorted_t, InputIt first, InputIt last,
+           const Compare& comp = Compare());
   multiset(const multiset& other);
   multiset(multiset&& other);
   ~multiset();
 
   multiset& operator=(const multiset& other);
   multiset& operator=(multiset&& other);
+  // get_allocator() returns the allocator the nodes are allocated with
+  allocator_type get_allocator() const;
+  // key_comp() and value_comp() return the function that orders the keys
+  key_compare key_comp() const;
+  value_compare value_comp() const;
 
   // Multiset Iterators
   // begin() returns an iterator to the beginning
@@ -78,15 +105,33 @@ class multiset {
   // insert() inserts node and returns iterator to where the element is in the
   // container
   iterator insert(const value_type& value);
+  // insert(hint, value) inserts value as close as possible before hint, in
+  // amortized O(1) when that keeps the order
+  iterator insert(const_iterator hint, const value_type& value);
+  // insert(first, last) inserts a range, in O(n) when the multiset is empty
+  // and the range is sorted
+  template <typename InputIt, typename = typename std::iterator_traits<
+                                  InputIt>::iterator_category>
+  void insert(InputIt first, InputIt last);
+  // insert(handle) links an extracted node, allocating nothing when the
+  // allocators compare equal
+  iterator insert(node_type&& handle);
+  iterator insert(const_iterator hint, node_type&& handle);
   // erase() erases element at pos
   void erase(iterator pos);
+  // extract() unlinks an element, the first one equal to key for
+  // extract(key), and hands its node over without freeing it
+  node_type extract(const_iterator pos);
+  node_type extract(const key_type& key);
   // swap() swaps the contents
   void swap(multiset& other);
   // merge() splices nodes from another container
   void merge(multiset& other);
 
   // Multiset Lookup
-  // count() returns the number of elements matching specific key
+  // count() returns the number of elements matching specific key. A plain
+  // multiset walks the k matches in O(log n + k); the fast O(log n) count
+  // needs multiset_options::kRanked or kRunLength
   size_type count(const value_type& key) const;
   // find() finds element with specific key
   iterator find(const value_type& key);
@@ -105,693 +150,504 @@ class multiset {
   // given key
   iterator upper_bound(const value_type& key);
   const_iterator upper_bound(const value_type& key) const;
+  // range() returns a view of the elements in [from, to), empty unless from
+  // is less than to, in O(log n)
+  tree::Range<const_iterator> range(const value_type& from,
+                                    const value_type& to) const;
+  // with a transparent Compare the lookups take any type it can compare with
+  // a key, without building a key_type
+  template <typename K, typename = tree::IfTransparent<Compare, K>>
+  size_type count(const K& key) const;
+  template <typename K, typename = tree::IfTransparent<Compare, K>>
+  iterator find(const K& key);
+  template <typename K, typename = tree::IfTransparent<Compare, K>>
+  const_iterator find(const K& key) const;
+  template <typename K, typename = tree::IfTransparent<Compare, K>>
+  bool contains(const K& key) const;
+  template <typename K, typename = tree::IfTransparent<Compare, K>>
+  std::pair<iterator, iterator> equal_range(const K& key);
+  template <typename K, typename = tree::IfTransparent<Compare, K>>
+  std::pair<const_iterator, const_iterator> equal_range(const K& key) const;
+  template <typename K, typename = tree::IfTransparent<Compare, K>>
+  iterator lower_bound(const K& key);
+  template <typename K, typename = tree::IfTransparent<Compare, K>>
+  const_iterator lower_bound(const K& key) const;
+  template <typename K, typename = tree::IfTransparent<Compare, K>>
+  iterator upper_bound(const K& key);
+  template <typename K, typename = tree::IfTransparent<Compare, K>>
+  const_iterator upper_bound(const K& key) const;
+  template <typename K, typename = tree::IfTransparent<Compare, K>>
+  tree::Range<const_iterator> range(const K& from, const K& to) const;
+
+  // Multiset Order Statistics, only for a ranked multiset
+  // nth() returns an iterator to the element at index k in sorted order, or
+  // end() when k is not less than size()
+  iterator nth(size_type k);
+  const_iterator nth(size_type k) const;
+  // count_less() returns the number of elements less than key, rank() the
+  // number of elements not greater than key
+  size_type count_less(const key_type& key) const;
+  size_type rank(const key_type& key) const;
+  template <typename K, typename = tree::IfTransparent<Compare, K>>
+  size_type count_less(const K& key) const;
+  template <typename K, typename = tree::IfTransparent<Compare, K>>
+  size_type rank(const K& key) const;
 
   // Multiset Emplace
   // emplace() inserts new elements into the container
   template <typename... Args>
   vector<std::pair<iterator, bool>> emplace(Args&&... args);
+  // emplace_hint() constructs an element and inserts it like insert(hint)
+  template <typename... Args>
+  iterator emplace_hint(const_iterator hint, Args&&... args);
 
  private:
-  pointer_to_node root_;
-  pointer_to_node fake_node_;
-  size_type size_ = 0;
-
-  // Private Node class
-  class BinaryTreeNode {
-   public:
-    using value_type = Key;
-    using pointer_to_node = BinaryTreeNode*;
+  using tree_type = tree::RbTree<node, tree::Identity, Compare, Alloc, false>;
 
-   public:
-    BinaryTreeNode();
-    BinaryTreeNode(value_type data, pointer_to_node top = nullptr,
-                   pointer_to_node left = nullptr,
-                   pointer_to_node right = nullptr);
-    pointer_to_node NextNode();
-    pointer_to_node PreviousNode();
-    pointer_to_node FarLeft();
-    pointer_to_node FarRight();
-    pointer_to_node FarTop();
-    void CleanNodePointers();
-
-    value_type value_;
-    pointer_to_node top_;
-    pointer_to_node left_;
-    pointer_to_node right_;
-  };
+  tree_type tree_;
 
   // Multiset Helper Methods
-  void DeleteNodes(pointer_to_node node);
-  pointer_to_node RecursiveFind(const value_type& value,
-                                pointer_to_node node) const;
-  void InsertForMerge(pointer_to_node node);
-  void EraseLeafNode(pointer_to_node node_to_erase);
-  void EraseNodeOneChildren(pointer_to_node node);
-  void EraseNodeTwoChildren(pointer_to_node node);
-  void WhileLoopForInsert(pointer_to_node node);
-  void EraseLogicForMerge(multiset& other, pointer_to_node node);
-  void EraseLogicForLeafNode(multiset& other, pointer_to_node node_to_erase);
-  void EraseLogicForOneChildrenNode(multiset& other, pointer_to_node node);
-  void RecursiveCopyWholeSet(pointer_to_node node, const multiset& other);
-  iterator LowerBoundHelper(iterator& result, const Key& key) const;
-  iterator UpperBoundHelper(iterator& result, const Key& key) const;
   std::pair<iterator, bool> InsertForEmplace(const value_type& value);
-  void CopySwapWithStd(multiset& one, multiset& two) noexcept;
 };
 
-// TreeIterator class implementation
+// ranked_multiset is a multiset with order statistics
+template <typename Key, typename Compare = std::less<Key>,
+          typename Alloc = std::allocator<Key>>
+using ranked_multiset =
+    multiset<Key, Compare, Alloc, multiset_options::kRanked>;
 
-template <typename T>
-multiset<T>::TreeIterator::TreeIterator() : ptr_(nullptr) {}
+// run_length_multiset is a multiset that keeps equal elements in one node
+template <typename Key, typename Compare = std::less<Key>,
+          typename Alloc = std::allocator<Key>>
+using run_length_multiset =
+    multiset<Key, Compare, Alloc, multiset_options::kRunLength>;
 
-template <typename T>
-multiset<T>::TreeIterator::TreeIterator(pointer_to_node ptr) : ptr_(ptr) {}
+// node_type class implementation
 
-template <typename T>
-typename multiset<T>::TreeIterator& multiset<T>::TreeIterator::operator++() {
-  if (ptr_ == ptr_->FarTop()->FarRight()) {
-    --(*this);
-  } else {
-    ptr_ = ptr_->NextNode();
-  }
-  return *this;
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+multiset<T, Compare, Alloc, kOptions>::node_type::node_type(
+    pointer_to_node node, const typename node_handle::node_allocator& alloc)
+    : node_handle(node, alloc) {}
+
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+typename multiset<T, Compare, Alloc, kOptions>::value_type&
+multiset<T, Compare, Alloc, kOptions>::node_type::value() const {
+  return this->node_->value_;
 }
 
-template <typename T>
-typename multiset<T>::TreeIterator multiset<T>::TreeIterator::operator++(int) {
-  TreeIterator temp = *this;
-  ++(*this);
-  return temp;
+// Multiset class implementation
+
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+multiset<T, Compare, Alloc, kOptions>::multiset() : multiset(Compare()) {}
+
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+multiset<T, Compare, Alloc, kOptions>::multiset(const Compare& comp,
+                                               const allocator_type& alloc)
+    : tree_(comp, typename tree_type::node_allocator(alloc)) {}
+
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+multiset<T, Compare, Alloc, kOptions>::multiset(const allocator_type& alloc)
+    : multiset(Compare(), alloc) {}
+
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+multiset<T, Compare, Alloc, kOptions>::multiset(
+    std::initializer_list<value_type> const& items)
+    : multiset() {
+  tree_.InsertRange(items.begin(), items.end(), true, false);
 }
 
-template <typename T>
-typename multiset<T>::TreeIterator& multiset<T>::TreeIterator::operator--() {
-  if (ptr_ == ptr_->FarTop()->FarLeft()) {
-    ptr_ = ptr_->FarTop()->FarRight();
-  } else {
-    ptr_ = ptr_->PreviousNode();
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+template <typename InputIt, typename>
+multiset<T, Compare, Alloc, kOptions>::multiset(InputIt first, InputIt last,
+                                               const Compare& comp)
+    : multiset(comp) {
+  tree_.InsertRange(first, last, true, false);
+}
+
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+template <typename InputIt>
+multiset<T, Compare, Alloc, kOptions>::multiset(assume_sorted_t, InputIt first,
+                                               InputIt last,
+                                               const Compare& comp)
+    : multiset(comp) {
+  tree_.InsertRange(first, last, false, false);
+}
+
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+multiset<T, Compare, Alloc, kOptions>::multiset(const multiset& other)
+    : tree_(other.tree_) {}
+
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+multiset<T, Compare, Alloc, kOptions>::multiset(multiset&& other)
+    : tree_(std::move(other.tree_)) {}
+
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+multiset<T, Compare, Alloc, kOptions>::~multiset() = default;
+
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+multiset<T, Compare, Alloc, kOptions>&
+multiset<T, Compare, Alloc, kOptions>::operator=(const multiset& other) {
+  if (this != &other) {
+    multiset temp(other);
+    swap(temp);
   }
   return *this;
 }
 
-template <typename T>
-typename multiset<T>::TreeIterator multiset<T>::TreeIterator::operator--(int) {
-  TreeIterator temp = *this;
-  --(*this);
-  return temp;
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+multiset<T, Compare, Alloc, kOptions>&
+multiset<T, Compare, Alloc, kOptions>::operator=(multiset&& other) {
+  if (this != &other) {
+    multiset temp(std::move(other));
+    swap(temp);
+  }
+  return *this;
 }
 
-template <typename T>
-typename multiset<T>::TreeIterator::const_reference
-multiset<T>::TreeIterator::operator*() const {
-  return ptr_->value_;
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+typename multiset<T, Compare, Alloc, kOptions>::allocator_type
+multiset<T, Compare, Alloc, kOptions>::get_allocator() const {
+  return allocator_type(tree_.GetAllocator());
 }
 
-template <typename T>
-bool multiset<T>::TreeIterator::operator==(const TreeIterator& other) {
-  return ptr_ == other.ptr_;
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+typename multiset<T, Compare, Alloc, kOptions>::key_compare
+multiset<T, Compare, Alloc, kOptions>::key_comp() const {
+  return tree_.KeyComp();
 }
 
-template <typename T>
-bool multiset<T>::TreeIterator::operator!=(const TreeIterator& other) {
-  return !(ptr_ == other.ptr_);
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+typename multiset<T, Compare, Alloc, kOptions>::value_compare
+multiset<T, Compare, Alloc, kOptions>::value_comp() const {
+  return tree_.KeyComp();
 }
 
-// BinaryNodeTree class implementation
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+typename multiset<T, Compare, Alloc, kOptions>::iterator
+multiset<T, Compare, Alloc, kOptions>::begin() {
+  return tree_.Begin();
+}
 
-template <typename T>
-multiset<T>::BinaryTreeNode::BinaryTreeNode()
-    : top_(nullptr), left_(nullptr), right_(nullptr) {}
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+typename multiset<T, Compare, Alloc, kOptions>::const_iterator
+multiset<T, Compare, Alloc, kOptions>::begin() const {
+  return tree_.Begin();
+}
 
-template <typename T>
-multiset<T>::BinaryTreeNode::BinaryTreeNode(value_type data,
-                                            pointer_to_node top,
-                                            pointer_to_node left,
-                                            pointer_to_node right)
-    : value_(data), top_(top), left_(left), right_(right) {}
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+typename multiset<T, Compare, Alloc, kOptions>::iterator
+multiset<T, Compare, Alloc, kOptions>::end() {
+  return tree_.End();
+}
 
-template <typename T>
-typename multiset<T>::BinaryTreeNode::pointer_to_node
-multiset<T>::BinaryTreeNode::NextNode() {
-  pointer_to_node temp = this;
-  if (temp->right_) {
-    temp = temp->right_;
-    while (temp->left_) temp = temp->left_;
-  } else {
-    while (temp->top_ && temp == temp->top_->right_) {
-      temp = temp->top_;
-    }
-    temp = temp->top_;
-  }
-  return temp;
-}
-
-template <typename T>
-typename multiset<T>::BinaryTreeNode::pointer_to_node
-multiset<T>::BinaryTreeNode::PreviousNode() {
-  pointer_to_node temp = this;
-  if (temp->left_) {
-    temp = temp->left_;
-    while (temp->right_) temp = temp->right_;
-  } else {
-    while (temp->top_ && temp == temp->top_->left_) {
-      temp = temp->top_;
-    }
-    temp = temp->top_;
-  }
-  return temp;
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+typename multiset<T, Compare, Alloc, kOptions>::const_iterator
+multiset<T, Compare, Alloc, kOptions>::end() const {
+  return tree_.End();
 }
 
-template <typename T>
-typename multiset<T>::BinaryTreeNode::pointer_to_node
-multiset<T>::BinaryTreeNode::FarLeft() {
-  pointer_to_node temp(this);
-  while (temp->left_) temp = temp->left_;
-  return temp;
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+bool multiset<T, Compare, Alloc, kOptions>::empty() const {
+  return tree_.Size() == 0;
 }
 
-template <typename T>
-typename multiset<T>::BinaryTreeNode::pointer_to_node
-multiset<T>::BinaryTreeNode::FarRight() {
-  pointer_to_node temp(this);
-  while (temp->right_) temp = temp->right_;
-  return temp;
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+typename multiset<T, Compare, Alloc, kOptions>::size_type
+multiset<T, Compare, Alloc, kOptions>::size() const {
+  return tree_.Size();
 }
 
-template <typename T>
-typename multiset<T>::BinaryTreeNode::pointer_to_node
-multiset<T>::BinaryTreeNode::FarTop() {
-  pointer_to_node temp(this);
-  while (temp->top_) temp = temp->top_;
-  return temp;
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+typename multiset<T, Compare, Alloc, kOptions>::size_type
+multiset<T, Compare, Alloc, kOptions>::max_size() const {
+  return SIZE_MAX / sizeof(value_type) / 20;
 }
 
-template <typename T>
-void multiset<T>::BinaryTreeNode::CleanNodePointers() {
-  top_ = nullptr;
-  left_ = nullptr;
-  right_ = nullptr;
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+void multiset<T, Compare, Alloc, kOptions>::clear() {
+  tree_.Clear();
 }
 
-// Multiset class implementation
+// insert() places value after the elements equal to it, like std::multiset
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+typename multiset<T, Compare, Alloc, kOptions>::iterator
+multiset<T, Compare, Alloc, kOptions>::insert(const value_type& value) {
+  return tree_.Emplace(value, value).first;
+}
 
-template <typename T>
-multiset<T>::multiset() {
-  root_ = new node();
-  fake_node_ = new node();
-  root_->right_ = fake_node_;
-  fake_node_->top_ = root_;
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+typename multiset<T, Compare, Alloc, kOptions>::iterator
+multiset<T, Compare, Alloc, kOptions>::insert(const_iterator hint,
+                                             const value_type& value) {
+  return tree_.EmplaceHint(hint, value, value).first;
 }
 
-template <typename T>
-multiset<T>::multiset(std::initializer_list<value_type> const& items)
-    : multiset() {
-  for (auto ptr = items.begin(); ptr != items.end(); ++ptr) {
-    insert(*ptr);
-  }
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+template <typename InputIt, typename>
+void multiset<T, Compare, Alloc, kOptions>::insert(InputIt first,
+                                                   InputIt last) {
+  tree_.InsertRange(first, last, true, false);
 }
 
-template <typename T>
-multiset<T>::multiset(const multiset& other) : multiset() {
-  if (other.size_ > 0) {
-    RecursiveCopyWholeSet(other.root_, other);
-    size_ = other.size_;
-  }
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+typename multiset<T, Compare, Alloc, kOptions>::iterator
+multiset<T, Compare, Alloc, kOptions>::insert(node_type&& handle) {
+  return tree_.Reinsert(handle).first;
 }
 
-template <typename T>
-multiset<T>::multiset(multiset&& other) : multiset() {
-  CopySwapWithStd(*this, other);
-  other.size_ = 0;
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+typename multiset<T, Compare, Alloc, kOptions>::iterator
+multiset<T, Compare, Alloc, kOptions>::insert(const_iterator hint,
+                                             node_type&& handle) {
+  return tree_.Reinsert(hint, handle).first;
 }
 
-template <typename T>
-multiset<T>::~multiset() {
-  clear();
-  delete fake_node_;
-  delete root_;
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+void multiset<T, Compare, Alloc, kOptions>::erase(iterator pos) {
+  tree_.Erase(pos);
 }
 
-template <typename T>
-multiset<T>& multiset<T>::operator=(const multiset& other) {
-  if (this != &other) {
-    multiset<value_type> temp(other);
-    CopySwapWithStd(*this, temp);
-  }
-  return *this;
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+typename multiset<T, Compare, Alloc, kOptions>::node_type
+multiset<T, Compare, Alloc, kOptions>::extract(const_iterator pos) {
+  return node_type(tree_.Extract(pos), tree_.GetAllocator());
 }
 
-template <typename T>
-multiset<T>& multiset<T>::operator=(multiset&& other) {
-  if (this != &other) {
-    multiset<value_type> temp(std::move(other));
-    CopySwapWithStd(*this, temp);
-  }
-  return *this;
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+typename multiset<T, Compare, Alloc, kOptions>::node_type
+multiset<T, Compare, Alloc, kOptions>::extract(const key_type& key) {
+  iterator found = find(key);
+  if (found == end()) return node_type();
+  return extract(found);
 }
 
-template <typename T>
-typename multiset<T>::iterator multiset<T>::begin() {
-  return empty() ? end() : iterator(root_->FarLeft());
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+void multiset<T, Compare, Alloc, kOptions>::swap(multiset& other) {
+  tree_.Swap(other.tree_);
 }
 
-template <typename T>
-typename multiset<T>::const_iterator multiset<T>::begin() const {
-  return empty() ? end() : iterator(root_->FarLeft());
+// merge() relinks every node of other into this tree
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+void multiset<T, Compare, Alloc, kOptions>::merge(multiset& other) {
+  tree_.Merge(other.tree_);
 }
 
-template <typename T>
-typename multiset<T>::iterator multiset<T>::end() {
-  return iterator(root_->FarRight());
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+typename multiset<T, Compare, Alloc, kOptions>::size_type
+multiset<T, Compare, Alloc, kOptions>::count(const value_type& key) const {
+  return tree_.Count(key);
 }
 
-template <typename T>
-typename multiset<T>::const_iterator multiset<T>::end() const {
-  return iterator(root_->FarRight());
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+typename multiset<T, Compare, Alloc, kOptions>::iterator
+multiset<T, Compare, Alloc, kOptions>::find(const value_type& key) {
+  return tree_.Find(key);
 }
 
-template <typename T>
-bool multiset<T>::empty() const {
-  return size_ == 0;
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+typename multiset<T, Compare, Alloc, kOptions>::const_iterator
+multiset<T, Compare, Alloc, kOptions>::find(const value_type& key) const {
+  return tree_.Find(key);
 }
 
-template <typename T>
-typename multiset<T>::size_type multiset<T>::size() const {
-  return size_;
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+bool multiset<T, Compare, Alloc, kOptions>::contains(
+    const value_type& key) const {
+  return tree_.Find(key) != tree_.End();
 }
 
-template <typename T>
-typename multiset<T>::size_type multiset<T>::max_size() const {
-  return SIZE_MAX / sizeof(value_type) / 20;
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+std::pair<typename multiset<T, Compare, Alloc, kOptions>::iterator,
+          typename multiset<T, Compare, Alloc, kOptions>::iterator>
+multiset<T, Compare, Alloc, kOptions>::equal_range(const value_type& key) {
+  return tree_.EqualRange(key);
 }
 
-template <typename T>
-void multiset<T>::clear() {
-  DeleteNodes(root_);
-  root_->left_ = nullptr;
-  root_->right_ = fake_node_;
-  fake_node_->top_ = root_;
-  size_ = 0;
-  fake_node_->value_ = size_;
-}
-
-template <typename T>
-typename multiset<T>::iterator multiset<T>::insert(const value_type& value) {
-  pointer_to_node temp = new node(value);
-  iterator result;
-  if (empty()) {
-    root_->value_ = value;
-    ++size_;
-    fake_node_->value_ = size_;
-    result.ptr_ = root_;
-    delete temp;
-  } else {
-    WhileLoopForInsert(temp);
-    ++size_;
-    fake_node_->value_ = size_;
-    result.ptr_ = temp;
-  }
-  return result;
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+std::pair<typename multiset<T, Compare, Alloc, kOptions>::const_iterator,
+          typename multiset<T, Compare, Alloc, kOptions>::const_iterator>
+multiset<T, Compare, Alloc, kOptions>::equal_range(
+    const value_type& key) const {
+  return tree_.EqualRange(key);
 }
 
-template <typename T>
-void multiset<T>::erase(iterator pos) {
-  pointer_to_node current = pos.ptr_;
-  // end cant be erase
-  if (current == end().ptr_) {
-    throw std::logic_error(
-        "The end() iterator cannot be used as a value for pos\n");
-    // if node is a leaf (got no children) or right children is fake
-  } else if (!current->left_ &&
-             (!current->right_ || current->right_ == fake_node_)) {
-    EraseLeafNode(current);
-    // if node got one childres (left OR right)
-  } else if ((current->left_ && !current->right_) ||
-             (!current->left_ && current->right_)) {
-    EraseNodeOneChildren(current);
-    // if node got two childrens
-  } else if (current->left_ && current->right_) {
-    EraseNodeTwoChildren(current);
-  }
-  --size_;
-  fake_node_->value_ = size_;
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+typename multiset<T, Compare, Alloc, kOptions>::iterator
+multiset<T, Compare, Alloc, kOptions>::lower_bound(const value_type& key) {
+  return tree_.LowerBound(key);
 }
 
-template <typename T>
-void multiset<T>::swap(multiset& other) {
-  CopySwapWithStd(*this, other);
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+typename multiset<T, Compare, Alloc, kOptions>::const_iterator
+multiset<T, Compare, Alloc, kOptions>::lower_bound(
+    const value_type& key) const {
+  return tree_.LowerBound(key);
 }
 
-template <typename T>
-void multiset<T>::merge(multiset& other) {
-  for (auto i = other.root_->FarLeft(); i != other.root_->FarRight();) {
-    pointer_to_node to_merge = i;
-    i = i->NextNode();
-    EraseLogicForMerge(other, to_merge);
-    InsertForMerge(to_merge);
-    ++size_;
-    fake_node_->value_ = size_;
-  }
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+typename multiset<T, Compare, Alloc, kOptions>::iterator
+multiset<T, Compare, Alloc, kOptions>::upper_bound(const value_type& key) {
+  return tree_.UpperBound(key);
 }
 
-template <typename T>
-typename multiset<T>::size_type multiset<T>::count(
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+typename multiset<T, Compare, Alloc, kOptions>::const_iterator
+multiset<T, Compare, Alloc, kOptions>::upper_bound(
     const value_type& key) const {
-  size_type result = 0;
-  auto i = find(key);
-  if (i != end()) {
-    while (i.ptr_->value_ == key) {
-      ++i;
-      ++result;
-    }
-  }
-  return result;
+  return tree_.UpperBound(key);
 }
 
-template <typename T>
-typename multiset<T>::iterator multiset<T>::find(const value_type& key) {
-  iterator result(RecursiveFind(key, root_));
-  return result;
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+template <typename K, typename>
+typename multiset<T, Compare, Alloc, kOptions>::size_type
+multiset<T, Compare, Alloc, kOptions>::count(const K& key) const {
+  return tree_.Count(key);
 }
 
-template <typename T>
-typename multiset<T>::const_iterator multiset<T>::find(
-    const value_type& key) const {
-  const_iterator result(RecursiveFind(key, root_));
-  return result;
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+template <typename K, typename>
+typename multiset<T, Compare, Alloc, kOptions>::iterator
+multiset<T, Compare, Alloc, kOptions>::find(const K& key) {
+  return tree_.Find(key);
 }
 
-template <typename T>
-bool multiset<T>::contains(const value_type& key) const {
-  bool result = false;
-  if (RecursiveFind(key, root_) != end().ptr_) {
-    result = true;
-  }
-  return result;
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+template <typename K, typename>
+typename multiset<T, Compare, Alloc, kOptions>::const_iterator
+multiset<T, Compare, Alloc, kOptions>::find(const K& key) const {
+  return tree_.Find(key);
 }
 
-template <typename T>
-std::pair<typename multiset<T>::iterator, typename multiset<T>::iterator>
-multiset<T>::equal_range(const value_type& key) {
-  iterator first, second;
-  first = lower_bound(key);
-  second = upper_bound(key);
-  return std::pair<iterator, iterator>(first, second);
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+template <typename K, typename>
+bool multiset<T, Compare, Alloc, kOptions>::contains(const K& key) const {
+  return tree_.Find(key) != tree_.End();
 }
 
-template <typename T>
-std::pair<typename multiset<T>::const_iterator,
-          typename multiset<T>::const_iterator>
-multiset<T>::equal_range(const value_type& key) const {
-  const_iterator first, second;
-  first = lower_bound(key);
-  second = upper_bound(key);
-  return std::pair<const_iterator, const_iterator>(first, second);
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+template <typename K, typename>
+std::pair<typename multiset<T, Compare, Alloc, kOptions>::iterator,
+          typename multiset<T, Compare, Alloc, kOptions>::iterator>
+multiset<T, Compare, Alloc, kOptions>::equal_range(const K& key) {
+  return tree_.EqualRange(key);
 }
 
-template <typename T>
-typename multiset<T>::iterator multiset<T>::lower_bound(const value_type& key) {
-  iterator result = end();
-  LowerBoundHelper(result, key);
-  return result;
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+template <typename K, typename>
+std::pair<typename multiset<T, Compare, Alloc, kOptions>::const_iterator,
+          typename multiset<T, Compare, Alloc, kOptions>::const_iterator>
+multiset<T, Compare, Alloc, kOptions>::equal_range(const K& key) const {
+  return tree_.EqualRange(key);
 }
 
-template <typename T>
-typename multiset<T>::const_iterator multiset<T>::lower_bound(
-    const value_type& key) const {
-  const_iterator result = end();
-  LowerBoundHelper(result, key);
-  return result;
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+template <typename K, typename>
+typename multiset<T, Compare, Alloc, kOptions>::iterator
+multiset<T, Compare, Alloc, kOptions>::lower_bound(const K& key) {
+  return tree_.LowerBound(key);
 }
 
-template <typename T>
-typename multiset<T>::iterator multiset<T>::upper_bound(const value_type& key) {
-  iterator result = end();
-  UpperBoundHelper(result, key);
-  return result;
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+template <typename K, typename>
+typename multiset<T, Compare, Alloc, kOptions>::const_iterator
+multiset<T, Compare, Alloc, kOptions>::lower_bound(const K& key) const {
+  return tree_.LowerBound(key);
 }
 
-template <typename T>
-typename multiset<T>::const_iterator multiset<T>::upper_bound(
-    const value_type& key) const {
-  const_iterator result = end();
-  UpperBoundHelper(result, key);
-  return result;
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+template <typename K, typename>
+typename multiset<T, Compare, Alloc, kOptions>::iterator
+multiset<T, Compare, Alloc, kOptions>::upper_bound(const K& key) {
+  return tree_.UpperBound(key);
 }
 
-template <typename T>
-template <typename... Args>
-vector<std::pair<typename multiset<T>::iterator, bool>> multiset<T>::emplace(
-    Args&&... args) {
-  vector<std::pair<iterator, bool>> result = {(InsertForEmplace(args))...};
-  return result;
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+template <typename K, typename>
+typename multiset<T, Compare, Alloc, kOptions>::const_iterator
+multiset<T, Compare, Alloc, kOptions>::upper_bound(const K& key) const {
+  return tree_.UpperBound(key);
 }
 
-template <typename T>
-void multiset<T>::DeleteNodes(pointer_to_node node) {
-  if (node) {
-    DeleteNodes(node->left_);
-    DeleteNodes(node->right_);
-    if (node != root_ && node != fake_node_) {
-      delete node;
-    }
-  }
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+tree::Range<typename multiset<T, Compare, Alloc, kOptions>::const_iterator>
+multiset<T, Compare, Alloc, kOptions>::range(const value_type& from,
+                                             const value_type& to) const {
+  return tree_.RangeOf(from, to);
 }
 
-template <typename T>
-typename multiset<T>::pointer_to_node multiset<T>::RecursiveFind(
-    const value_type& value, pointer_to_node node) const {
-  if (node == fake_node_ || size_ == 0 || !node) return end().ptr_;
-  if (value == node->value_) {
-    return (node->left_ && node->left_->value_ == value)
-               ? RecursiveFind(value, node->left_)
-               : node;
-  } else {
-    return (value < node->value_) ? RecursiveFind(value, node->left_)
-                                  : RecursiveFind(value, node->right_);
-  }
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+template <typename K, typename>
+tree::Range<typename multiset<T, Compare, Alloc, kOptions>::const_iterator>
+multiset<T, Compare, Alloc, kOptions>::range(const K& from,
+                                             const K& to) const {
+  return tree_.RangeOf(from, to);
 }
 
-template <typename T>
-void multiset<T>::InsertForMerge(pointer_to_node node) {
-  node->CleanNodePointers();
-  if (empty()) {
-    delete root_;
-    root_ = node;
-    root_->right_ = fake_node_;
-    fake_node_->top_ = root_;
-  } else {
-    WhileLoopForInsert(node);
-  }
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+typename multiset<T, Compare, Alloc, kOptions>::iterator
+multiset<T, Compare, Alloc, kOptions>::nth(size_type k) {
+  static_assert(kRanked, "nth() needs a ranked multiset");
+  return tree_.Nth(k);
 }
 
-template <typename T>
-void multiset<T>::EraseLeafNode(pointer_to_node node_to_erase) {
-  if (node_to_erase == root_ && node_to_erase->right_ == fake_node_) {
-    delete root_;
-    root_ = new node();
-    root_->right_ = fake_node_;
-    fake_node_->top_ = root_;
-    return;
-  }
-  if (node_to_erase->top_->left_ == node_to_erase) {
-    node_to_erase->top_->left_ = nullptr;
-  } else {
-    if (node_to_erase->right_ == fake_node_) {
-      node_to_erase->top_->right_ = fake_node_;
-    } else {
-      node_to_erase->top_->right_ = nullptr;
-    }
-  }
-  delete node_to_erase;
-}
-
-template <typename T>
-void multiset<T>::EraseNodeOneChildren(pointer_to_node node) {
-  pointer_to_node child = (node->left_) ? node->left_ : node->right_;
-  if (node != root_) {
-    if (node == node->top_->left_) {
-      node->top_->left_ = child;
-      child->top_ = node->top_;
-    } else {
-      node->top_->right_ = child;
-      child->top_ = node->top_;
-    }
-  } else {
-    root_ = child;
-    root_->top_ = nullptr;
-  }
-  delete node;
-}
-
-template <typename T>
-void multiset<T>::EraseNodeTwoChildren(pointer_to_node node) {
-  pointer_to_node prev = node->PreviousNode();
-  pointer_to_node& parent_pointer =
-      (prev == prev->top_->left_) ? prev->top_->left_ : prev->top_->right_;
-  if (prev->left_) {
-    prev->left_->top_ = prev->top_;
-    parent_pointer = prev->left_;
-  } else {
-    parent_pointer = nullptr;
-  }
-  node->value_ = prev->value_;
-  delete prev;
-}
-
-template <typename T>
-void multiset<T>::WhileLoopForInsert(pointer_to_node node) {
-  pointer_to_node current = root_;
-  while (true) {
-    if (node->value_ < current->value_) {
-      if (current->left_ == nullptr) {
-        current->left_ = node;
-        node->top_ = current;
-        break;
-      } else {
-        current = current->left_;
-      }
-    } else if ((node->value_ > current->value_) && current != fake_node_) {
-      if (current->right_ == nullptr) {
-        current->right_ = node;
-        node->top_ = current;
-        break;
-      } else {
-        current = current->right_;
-      }
-    } else if (current == fake_node_) {
-      fake_node_->top_->right_ = node;
-      node->top_ = fake_node_->top_;
-      node->right_ = fake_node_;
-      fake_node_->top_ = node;
-      break;
-    } else {
-      if (current->left_) {
-        node->top_ = current->left_->top_;
-        node->left_ = current->left_;
-        current->left_->top_ = node;
-        current->left_ = node;
-      } else {
-        current->left_ = node;
-        node->top_ = current;
-      }
-      break;
-    }
-  }
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+typename multiset<T, Compare, Alloc, kOptions>::const_iterator
+multiset<T, Compare, Alloc, kOptions>::nth(size_type k) const {
+  static_assert(kRanked, "nth() needs a ranked multiset");
+  return tree_.Nth(k);
 }
 
-template <typename T>
-void multiset<T>::EraseLogicForMerge(multiset& other, pointer_to_node node) {
-  pointer_to_node current = node;
-  if (!current->left_ &&
-      (!current->right_ || current->right_ == other.fake_node_)) {
-    EraseLogicForLeafNode(other, current);
-  } else if ((current->left_ && !current->right_) ||
-             (!current->left_ && current->right_)) {
-    EraseLogicForOneChildrenNode(other, current);
-  }
-  --other.size_;
-  other.fake_node_->value_ = other.size_;
-}
-
-template <typename T>
-void multiset<T>::EraseLogicForLeafNode(multiset& other,
-                                        pointer_to_node node_to_erase) {
-  if (node_to_erase == other.root_ &&
-      node_to_erase->right_ == other.fake_node_) {
-    other.root_ = new node();
-    other.root_->right_ = other.fake_node_;
-    other.fake_node_->top_ = other.root_;
-  } else {
-    node_to_erase->top_->left_ = nullptr;
-  }
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+typename multiset<T, Compare, Alloc, kOptions>::size_type
+multiset<T, Compare, Alloc, kOptions>::count_less(const key_type& key) const {
+  return tree_.CountBelow(key, false);
 }
 
-template <typename T>
-void multiset<T>::EraseLogicForOneChildrenNode(multiset& other,
-                                               pointer_to_node node) {
-  pointer_to_node child = (node->left_) ? node->left_ : node->right_;
-  if (node != other.root_) {
-    node->top_->left_ = child;
-    child->top_ = node->top_;
-  } else {
-    other.root_ = child;
-    other.root_->top_ = nullptr;
-  }
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+typename multiset<T, Compare, Alloc, kOptions>::size_type
+multiset<T, Compare, Alloc, kOptions>::rank(const key_type& key) const {
+  return tree_.CountBelow(key, true);
 }
 
-template <typename T>
-void multiset<T>::RecursiveCopyWholeSet(pointer_to_node node,
-                                        const multiset& other) {
-  if (empty()) insert(node->value_);
-  if (node->left_) insert(node->left_->value_);
-  if (node->right_ && node->right_ != other.fake_node_)
-    insert(node->right_->value_);
-  if (node->left_) RecursiveCopyWholeSet(node->left_, other);
-  if (node->right_ && node->right_ != other.fake_node_)
-    RecursiveCopyWholeSet(node->right_, other);
-}
-
-template <typename T>
-typename multiset<T>::iterator multiset<T>::LowerBoundHelper(
-    iterator& result, const value_type& key) const {
-  pointer_to_node current = root_;
-  while (true) {
-    if (current->value_ < key) {
-      if (current->right_) {
-        current = current->right_;
-      } else {
-        break;
-      }
-    } else {
-      result.ptr_ = current;
-      if (current->left_) {
-        current = current->left_;
-      } else {
-        break;
-      }
-    }
-  }
-  return result;
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+template <typename K, typename>
+typename multiset<T, Compare, Alloc, kOptions>::size_type
+multiset<T, Compare, Alloc, kOptions>::count_less(const K& key) const {
+  return tree_.CountBelow(key, false);
 }
 
-template <typename T>
-typename multiset<T>::iterator multiset<T>::UpperBoundHelper(
-    iterator& result, const value_type& key) const {
-  pointer_to_node current = root_;
-  while (true) {
-    if (current->value_ <= key) {
-      if (current->right_) {
-        current = current->right_;
-      } else {
-        break;
-      }
-    } else {
-      result.ptr_ = current;
-      if (current->left_) {
-        current = current->left_;
-      } else {
-        break;
-      }
-    }
-  }
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+template <typename K, typename>
+typename multiset<T, Compare, Alloc, kOptions>::size_type
+multiset<T, Compare, Alloc, kOptions>::rank(const K& key) const {
+  return tree_.CountBelow(key, true);
+}
+
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+template <typename... Args>
+vector<
+    std::pair<typename multiset<T, Compare, Alloc, kOptions>::iterator, bool>>
+multiset<T, Compare, Alloc, kOptions>::emplace(Args&&... args) {
+  vector<std::pair<iterator, bool>> result = {(InsertForEmplace(args))...};
   return result;
 }
 
-template <typename T>
-std::pair<typename multiset<T>::iterator, bool> multiset<T>::InsertForEmplace(
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+template <typename... Args>
+typename multiset<T, Compare, Alloc, kOptions>::iterator
+multiset<T, Compare, Alloc, kOptions>::emplace_hint(const_iterator hint,
+                                                   Args&&... args) {
+  return insert(hint, value_type(std::forward<Args>(args)...));
+}
+
+template <typename T, typename Compare, typename Alloc, unsigned kOptions>
+std::pair<typename multiset<T, Compare, Alloc, kOptions>::iterator, bool>
+multiset<T, Compare, Alloc, kOptions>::InsertForEmplace(
     const value_type& value) {
   auto result = insert(value);
   return std::pair<iterator, bool>(result, true);
 }
 
-template <typename T>
-void multiset<T>::CopySwapWithStd(multiset& one, multiset& two) noexcept {
-  std::swap(one.root_, two.root_);
-  std::swap(one.fake_node_, two.fake_node_);
-  std::swap(one.size_, two.size_);
-}
-
 }  // namespace s21
 
 #endif  // SRC_S21_MULTISET_H_
@@ -0,0 +1,188 @@
+#ifndef SRC_S21_NODE_POOL_H_
+#define SRC_S21_NODE_POOL_H_
+
+namespace s21 {
+// NodePoolStats describes what a NodePool has done so far
+struct NodePoolStats {
+  // nodes handed out and given back over the life of the pool
+  std::size_t allocations = 0;
+  std::size_t deallocations = 0;
+  // allocations served from the free list instead of fresh slab memory
+  std::size_t reused = 0;
+  // nodes currently handed out and nodes waiting on the free list
+  std::size_t in_use = 0;
+  std::size_t free = 0;
+  // slabs requested from the system and their total size in bytes
+  std::size_t blocks = 0;
+  std::size_t bytes = 0;
+};
+
+// NodePool hands out chunks of one fixed size, taken from slabs of
+// block_nodes chunks. Freed chunks go on an intrusive free list and are reused
+// before the slab is touched again; slabs are only released together with the
+// pool. The chunk size is fixed by the first allocation
+class NodePool {
+ public:
+  explicit NodePool(std::size_t block_nodes = 256);
+  NodePool(const NodePool &other) = delete;
+  NodePool &operator=(const NodePool &other) = delete;
+  ~NodePool();
+
+  // Fits() checks whether chunks of this pool can hold an object of the given
+  // size and alignment
+  bool Fits(std::size_t size, std::size_t align) const;
+  void *Allocate(std::size_t size);
+  void Deallocate(void *ptr);
+
+  std::size_t block_nodes() const;
+  const NodePoolStats &stats() const;
+
+ private:
+  struct FreeChunk {
+    FreeChunk *next_;
+  };
+  // Block is the header in front of every slab
+  struct alignas(std::max_align_t) Block {
+    Block *next_;
+  };
+
+  static std::size_t ChunkSize(std::size_t size);
+  void AddBlock();
+
+  std::size_t block_nodes_;
+  std::size_t chunk_size_ = 0;
+  FreeChunk *free_ = nullptr;
+  Block *blocks_ = nullptr;
+  unsigned char *next_chunk_ = nullptr;
+  unsigned char *block_end_ = nullptr;
+  NodePoolStats stats_;
+};
+
+// NodePoolAllocator serves single-object requests, which is all a node based
+// container makes, from a shared NodePool and everything else from
+// std::allocator. Rebound copies share the pool, so the allocator given to a
+// set is the one its nodes come from. A copied container gets a pool of its
+// own
+template <typename T>
+class NodePoolAllocator {
+ public:
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::false_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+  using is_always_equal = std::false_type;
+
+  explicit NodePoolAllocator(std::size_t block_nodes = 256)
+      : pool_(std::make_shared<NodePool>(block_nodes)) {}
+
+  template <typename U>
+  NodePoolAllocator(const NodePoolAllocator<U> &other) : pool_(other.pool_) {}
+
+  T *allocate(std::size_t n) {
+    if (n == 1 && pool_->Fits(sizeof(T), alignof(T))) {
+      return static_cast<T *>(pool_->Allocate(sizeof(T)));
+    }
+    return std::allocator<T>().allocate(n);
+  }
+
+  void deallocate(T *ptr, std::size_t n) {
+    if (n == 1 && pool_->Fits(sizeof(T), alignof(T))) {
+      pool_->Deallocate(ptr);
+    } else {
+      std::allocator<T>().deallocate(ptr, n);
+    }
+  }
+
+  NodePoolAllocator select_on_container_copy_construction() const {
+    return NodePoolAllocator(pool_->block_nodes());
+  }
+
+  // stats() returns the counters of the shared pool
+  const NodePoolStats &stats() const { return pool_->stats(); }
+
+  friend bool operator==(const NodePoolAllocator &one,
+                         const NodePoolAllocator &two) {
+    return one.pool_ == two.pool_;
+  }
+
+  friend bool operator!=(const NodePoolAllocator &one,
+                         const NodePoolAllocator &two) {
+    return !(one == two);
+  }
+
+ private:
+  template <typename U>
+  friend class NodePoolAllocator;
+
+  std::shared_ptr<NodePool> pool_;
+};
+
+// NodePool class implementation
+
+inline NodePool::NodePool(std::size_t block_nodes)
+    : block_nodes_(block_nodes ? block_nodes : 1) {}
+
+inline NodePool::~NodePool() {
+  while (blocks_) {
+    Block *next = blocks_->next_;
+    ::operator delete(blocks_);
+    blocks_ = next;
+  }
+}
+
+inline bool NodePool::Fits(std::size_t size, std::size_t align) const {
+  return align <= alignof(std::max_align_t) &&
+         (!chunk_size_ || ChunkSize(size) == chunk_size_);
+}
+
+inline void *NodePool::Allocate(std::size_t size) {
+  if (!chunk_size_) chunk_size_ = ChunkSize(size);
+  ++stats_.allocations;
+  ++stats_.in_use;
+  if (free_) {
+    FreeChunk *chunk = free_;
+    free_ = chunk->next_;
+    ++stats_.reused;
+    --stats_.free;
+    return chunk;
+  }
+  if (next_chunk_ == block_end_) AddBlock();
+  void *result = next_chunk_;
+  next_chunk_ += chunk_size_;
+  return result;
+}
+
+inline void NodePool::Deallocate(void *ptr) {
+  FreeChunk *chunk = static_cast<FreeChunk *>(ptr);
+  chunk->next_ = free_;
+  free_ = chunk;
+  ++stats_.deallocations;
+  --stats_.in_use;
+  ++stats_.free;
+}
+
+inline std::size_t NodePool::block_nodes() const { return block_nodes_; }
+
+inline const NodePoolStats &NodePool::stats() const { return stats_; }
+
+// ChunkSize() rounds size up so that every chunk of a slab stays aligned for
+// any type and can hold the free list link
+inline std::size_t NodePool::ChunkSize(std::size_t size) {
+  const std::size_t align = alignof(std::max_align_t);
+  if (size < sizeof(FreeChunk)) size = sizeof(FreeChunk);
+  return (size + align - 1) / align * align;
+}
+
+inline void NodePool::AddBlock() {
+  std::size_t bytes = sizeof(Block) + block_nodes_ * chunk_size_;
+  Block *block = static_cast<Block *>(::operator new(bytes));
+  block->next_ = blocks_;
+  blocks_ = block;
+  next_chunk_ = reinterpret_cast<unsigned char *>(block + 1);
+  block_end_ = next_chunk_ + block_nodes_ * chunk_size_;
+  ++stats_.blocks;
+  stats_.bytes += bytes;
+}
+}  // namespace s21
+
+#endif  // SRC_S21_NODE_POOL_H_
@@ -0,0 +1,854 @@
+#ifndef SRC_S21_RB_TREE_H_
+#define SRC_S21_RB_TREE_H_
+
+#include "s21_tree.h"
+
+// The red-black tree set, Map and multiset are built on. A container picks
+// the element, how its key is taken from it, whether keys are unique and
+// whether nodes are counted or run-length; placing, linking, lookups, copies,
+// node handles and iteration are all done here
+
+namespace s21 {
+namespace tree {
+// Identity and First are the key extractors of the tree containers: a set
+// element is its own key, a map element is a pair keyed by its first member
+struct Identity {
+  template <typename Value>
+  const Value &operator()(const Value &value) const {
+    return value;
+  }
+};
+
+struct First {
+  template <typename Pair>
+  const auto &operator()(const Pair &value) const {
+    return value.first;
+  }
+};
+
+// kConstKey tells whether the key is const in the element itself, as in the
+// pair<const Key, T> of a multimap, so the tree never writes it
+template <typename Value>
+inline constexpr bool kConstKey = false;
+
+template <typename Key, typename T>
+inline constexpr bool kConstKey<std::pair<const Key, T>> = true;
+
+// Node holds one element of a tree container, or copies_ equal ones with
+// kRunLength, and with kCounted the number of elements in its subtree. The
+// header is a Node as well, with a value-initialized element
+template <typename Value, bool kCounted = false, bool kRunLength = false>
+struct Node : NodeCount<kCounted>, NodeCopies<kRunLength> {
+  using value_type = Value;
+
+  Node() : value_() {}
+  // constructs the element in place from args
+  template <typename... Args>
+  explicit Node(std::in_place_t, Args &&...args)
+      : value_(std::forward<Args>(args)...) {}
+  Node(const Node &) = delete;
+  Node &operator=(const Node &) = delete;
+
+  // NextNode() and PreviousNode() return the neighbours in sorted order. The
+  // header follows the last node, and stepping back from the first node
+  // stops at the header
+  Node *NextNode() {
+    Node *temp = this;
+    if (temp->right_) {
+      temp = temp->right_;
+      while (temp->left_) temp = temp->left_;
+    } else {
+      while (temp->top_ && temp == temp->top_->right_) temp = temp->top_;
+      temp = temp->top_;
+    }
+    return temp;
+  }
+
+  Node *PreviousNode() {
+    Node *temp = this;
+    if (temp->left_) {
+      temp = temp->left_;
+      while (temp->right_) temp = temp->right_;
+    } else {
+      while (temp->top_ && temp == temp->top_->left_) temp = temp->top_;
+      if (temp->top_) temp = temp->top_;
+    }
+    return temp;
+  }
+
+  Node *FarLeft() {
+    Node *temp = this;
+    while (temp->left_) temp = temp->left_;
+    return temp;
+  }
+
+  Node *FarRight() {
+    Node *temp = this;
+    while (temp->right_) temp = temp->right_;
+    return temp;
+  }
+
+  Value value_;
+  Node *top_ = nullptr;
+  Node *left_ = nullptr;
+  Node *right_ = nullptr;
+  NodeColor color_ = NodeColor::kRed;
+};
+
+// CopyIndex<true> is a base for iterators over run-length nodes, which also
+// keep the index of the element within the node. Other iterators are a bare
+// pointer
+template <bool kRunLength>
+struct CopyIndex {
+  static constexpr std::size_t copy_ = 0;
+};
+
+template <>
+struct CopyIndex<true> {
+  std::size_t copy_ = 0;
+};
+
+// Iterator walks the elements of a tree container in order. The const one,
+// the default, is also the iterator of the containers whose elements are
+// never changed in place; a multimap's mapped values can be changed through
+// the mutable one, which converts to the const one
+template <typename Node, bool kConst = true>
+class Iterator : CopyIndex<kHasCopies<Node>> {
+  template <typename, typename, typename, typename, bool>
+  friend class RbTree;
+  template <typename, bool>
+  friend class Iterator;
+
+ public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using difference_type = std::ptrdiff_t;
+  using value_type = typename Node::value_type;
+  using pointer = std::conditional_t<kConst, const value_type *, value_type *>;
+  using reference =
+      std::conditional_t<kConst, const value_type &, value_type &>;
+  using const_reference = const value_type &;
+
+  Iterator() = default;
+  explicit Iterator(Node *ptr, [[maybe_unused]] std::size_t copy = 0)
+      : ptr_(ptr) {
+    if constexpr (kHasCopies<Node>) this->copy_ = copy;
+  }
+  template <bool kOther, typename = std::enable_if_t<kConst && !kOther>>
+  Iterator(const Iterator<Node, kOther> &other)
+      : Iterator(other.ptr_, other.copy_) {}
+
+  Iterator &operator++() {
+    // the header is the only node without a parent
+    if (!ptr_->top_) return --*this;
+    if constexpr (kHasCopies<Node>) {
+      if (this->copy_ + 1 < ptr_->copies_) {
+        ++this->copy_;
+        return *this;
+      }
+      this->copy_ = 0;
+    }
+    ptr_ = ptr_->NextNode();
+    return *this;
+  }
+
+  Iterator operator++(int) {
+    Iterator temp = *this;
+    ++*this;
+    return temp;
+  }
+
+  Iterator &operator--() {
+    if constexpr (kHasCopies<Node>) {
+      if (this->copy_ > 0) {
+        --this->copy_;
+        return *this;
+      }
+      ptr_ = ptr_->PreviousNode();
+      this->copy_ = ptr_->copies_ - 1;
+    } else {
+      ptr_ = ptr_->PreviousNode();
+    }
+    return *this;
+  }
+
+  Iterator operator--(int) {
+    Iterator temp = *this;
+    --*this;
+    return temp;
+  }
+
+  reference operator*() const { return ptr_->value_; }
+  pointer operator->() const { return &ptr_->value_; }
+
+  template <bool kOther>
+  bool operator==(const Iterator<Node, kOther> &other) const {
+    return ptr_ == other.ptr_ && this->copy_ == other.copy_;
+  }
+  template <bool kOther>
+  bool operator!=(const Iterator<Node, kOther> &other) const {
+    return !(*this == other);
+  }
+
+ private:
+  Node *ptr_ = nullptr;
+};
+
+// RbTree is the tree of a container whose elements are Node::value_type,
+// ordered by Compare on the keys KeyOf takes from them. With kUnique an
+// element whose key is present is not inserted; otherwise it goes after the
+// elements equal to it, or with a run-length Node joins their node. It owns
+// the header, which is also end(), and keeps the first and the last node, so
+// begin() and hints at either end are O(1)
+template <typename Node, typename KeyOf, typename Compare, typename Alloc,
+          bool kUnique>
+class RbTree {
+  static constexpr bool kRanked = kIsCounted<Node>;
+  static constexpr bool kRunLength = kHasCopies<Node>;
+
+ public:
+  using iterator = Iterator<Node>;
+  using size_type = std::size_t;
+  using node_handle = NodeHandle<Node, Alloc>;
+  using node_allocator =
+      typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+
+  RbTree(const Compare &comp, const node_allocator &alloc)
+      : compare_(comp), node_alloc_(alloc) {
+    header_ = NewNode();
+    leftmost_ = rightmost_ = header_;
+  }
+
+  // the copy allocates from select_on_container_copy_construction() of the
+  // allocator of other, and is cloned in O(n) without comparing keys
+  RbTree(const RbTree &other)
+      : RbTree(other.compare_,
+               node_traits::select_on_container_copy_construction(
+                   other.node_alloc_)) {
+    CopyTreeFrom(other);
+  }
+
+  // the moved-from tree keeps an empty header from the same allocator
+  RbTree(RbTree &&other) : RbTree(other.compare_, other.node_alloc_) {
+    Swap(other);
+  }
+
+  // the containers assign by copy and swap
+  RbTree &operator=(const RbTree &) = delete;
+
+  ~RbTree() {
+    Clear();
+    DeleteNode(header_);
+  }
+
+  node_allocator GetAllocator() const { return node_alloc_; }
+  const Compare &KeyComp() const { return compare_; }
+  iterator Begin() const { return iterator(leftmost_); }
+  iterator End() const { return iterator(header_); }
+  size_type Size() const { return size_; }
+
+  void Clear() {
+    DeleteNodes(Root());
+    header_->left_ = nullptr;
+    leftmost_ = rightmost_ = header_;
+    size_ = 0;
+    StoreSize();
+  }
+
+  void Swap(RbTree &other) noexcept {
+    using std::swap;
+    swap(header_, other.header_);
+    swap(leftmost_, other.leftmost_);
+    swap(rightmost_, other.rightmost_);
+    swap(size_, other.size_);
+    swap(compare_, other.compare_);
+    swap(node_alloc_, other.node_alloc_);
+  }
+
+  // Emplace() finds the place of key in one descent, EmplaceHint() from hint
+  // when key belongs next to it, and only then builds a node from args, so a
+  // key that is already present costs no element. The bool is false when
+  // kUnique found key, and the iterator is then to its element
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> Emplace(const K &key, Args &&...args) {
+    return EmplaceAt(nullptr, key, std::forward<Args>(args)...);
+  }
+
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> EmplaceHint(iterator hint, const K &key,
+                                        Args &&...args) {
+    return EmplaceAt(hint.ptr_, key, std::forward<Args>(args)...);
+  }
+
+  // EmplaceValue() builds the node from args first, for when the key has to
+  // be taken from the element, and EmplaceValueHint() places it from hint.
+  // With kUnique a node whose key is present is freed again
+  template <typename... Args>
+  std::pair<iterator, bool> EmplaceValue(Args &&...args) {
+    return EmplaceValueAt(nullptr, std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> EmplaceValueHint(iterator hint, Args &&...args) {
+    return EmplaceValueAt(hint.ptr_, std::forward<Args>(args)...);
+  }
+
+  // InsertRange() inserts a range. An empty tree chains nodes through right_
+  // while the range stays sorted and builds the chain into a balanced tree in
+  // one pass; the first key out of order ends the chain and the rest is
+  // inserted one by one. check_order and check_unique off trust the range to
+  // be sorted and, for kUnique, free of equal keys. Equal keys keep their
+  // order, and a run-length tree counts them into one node
+  template <typename InputIt>
+  void InsertRange(InputIt first, InputIt last, bool check_order,
+                   bool check_unique) {
+    if (size_) {
+      InsertEach(first, last);
+      return;
+    }
+    Node *head = nullptr;
+    Node *tail = nullptr;
+    size_type count = 0;
+    size_type elements = 0;
+    try {
+      for (; first != last; ++first) {
+        const auto &value = *first;
+        const auto &key = KeyOf()(value);
+        if (tail && check_order && compare_(key, Key(tail))) break;
+        if ((check_unique || kRunLength) && tail && !compare_(Key(tail), key)) {
+          if (check_unique) continue;
+          if constexpr (kRunLength) {
+            ++tail->copies_;
+            ++elements;
+            continue;
+          }
+        }
+        Node *temp = NewNode(std::in_place, value);
+        if (tail) {
+          tail->right_ = temp;
+        } else {
+          head = temp;
+        }
+        tail = temp;
+        ++count;
+        ++elements;
+      }
+    } catch (...) {
+      DeleteNodes(head);
+      throw;
+    }
+    tree::BuildSorted(head, count, header_);
+    if (head) {
+      leftmost_ = head;
+      rightmost_ = tail;
+    }
+    size_ = elements;
+    StoreSize();
+    InsertEach(first, last);
+  }
+
+  // Reinsert() links the node of handle, allocating nothing when the
+  // allocators compare equal. When kUnique finds its key the node stays in
+  // handle and the bool is false; otherwise handle ends up empty
+  std::pair<iterator, bool> Reinsert(node_handle &handle) {
+    return ReinsertAt(nullptr, handle);
+  }
+
+  std::pair<iterator, bool> Reinsert(iterator hint, node_handle &handle) {
+    return ReinsertAt(hint.ptr_, handle);
+  }
+
+  // Erase() frees the element at pos; end() is rejected
+  void Erase(iterator pos) {
+    Node *current = CheckedNode(pos);
+    if (tree::Weight(current) > 1) {
+      RemoveCopy(current);
+      return;
+    }
+    UnlinkNode(current);
+    DeleteNode(current);
+  }
+
+  // Extract() unlinks the element at pos and hands its node over without
+  // freeing it. One element of a run-length node gets a node of its own
+  Node *Extract(iterator pos) {
+    Node *current = CheckedNode(pos);
+    if (tree::Weight(current) > 1) {
+      Node *copy = NewNode(std::in_place, current->value_);
+      RemoveCopy(current);
+      return copy;
+    }
+    UnlinkNode(current);
+    return current;
+  }
+
+  // Merge() relinks the nodes of other into this tree, except those whose
+  // keys kUnique finds here. Nodes are copied only when the allocators
+  // differ, as a node has to be freed by the allocator that made it, and a
+  // run-length node whose key is already here only adds its count
+  void Merge(RbTree &other) {
+    if (this == &other) return;
+    for (Node *i = other.leftmost_; i != other.header_;) {
+      Node *to_merge = i;
+      i = i->NextNode();
+      Node *parent;
+      bool left;
+      const auto &key = Key(to_merge);
+      if (InsertPosition(key, parent, left)) continue;
+      Node *moved = to_merge;
+      if (JoinEqual(key, parent, left, tree::Weight(to_merge)).ptr_) {
+        moved = nullptr;
+      } else if (node_alloc_ != other.node_alloc_) {
+        moved = CopyNode(to_merge);
+      }
+      other.UnlinkNode(to_merge);
+      if (moved != to_merge) other.DeleteNode(to_merge);
+      if (moved) LinkNode(moved, parent, left);
+    }
+  }
+
+  // Find() returns the first element equivalent to key, or End()
+  template <typename K>
+  iterator Find(const K &key) const {
+    if constexpr (kUnique) {
+      for (Node *current = Root(); current;) {
+        if (compare_(key, Key(current))) {
+          current = current->left_;
+        } else if (compare_(Key(current), key)) {
+          current = current->right_;
+        } else {
+          return iterator(current);
+        }
+      }
+      return End();
+    } else {
+      Node *result = LowerBoundNode(key);
+      if (result != header_ && compare_(key, Key(result))) result = header_;
+      return iterator(result);
+    }
+  }
+
+  // LowerBound() and UpperBound() return the first element not less than,
+  // and greater than, key, or End()
+  template <typename K>
+  iterator LowerBound(const K &key) const {
+    return iterator(LowerBoundNode(key));
+  }
+
+  template <typename K>
+  iterator UpperBound(const K &key) const {
+    return iterator(UpperBoundNode(key));
+  }
+
+  // EqualRange() needs one descent for kUnique, as at most the lower bound
+  // is equivalent to key
+  template <typename K>
+  std::pair<iterator, iterator> EqualRange(const K &key) const {
+    if constexpr (kUnique) {
+      Node *lower = LowerBoundNode(key);
+      Node *upper = lower;
+      if (lower != header_ && !compare_(key, Key(lower))) {
+        upper = lower->NextNode();
+      }
+      return std::make_pair(iterator(lower), iterator(upper));
+    } else {
+      return std::make_pair(LowerBound(key), UpperBound(key));
+    }
+  }
+
+  // RangeOf() bounds [from, to) by two descents; a reversed interval is empty
+  // rather than a range that would run past End()
+  template <typename K>
+  Range<iterator> RangeOf(const K &from, const K &to) const {
+    if (!compare_(from, to)) return Range<iterator>(End(), End());
+    return Range<iterator>(LowerBound(from), LowerBound(to));
+  }
+
+  // Count() returns the number of elements equivalent to key, in O(log n)
+  // unless the tree takes equal keys and is neither ranked nor run-length
+  template <typename K>
+  size_type Count(const K &key) const {
+    if constexpr (kUnique) {
+      return Find(key) != End();
+    } else if constexpr (kRunLength) {
+      iterator found = Find(key);
+      return found == End() ? 0 : tree::Weight(found.ptr_);
+    } else if constexpr (kRanked) {
+      return CountBelow(key, true) - CountBelow(key, false);
+    } else {
+      size_type result = 0;
+      Node *last = UpperBoundNode(key);
+      for (Node *i = LowerBoundNode(key); i != last; i = i->NextNode()) {
+        ++result;
+      }
+      return result;
+    }
+  }
+
+  // Nth() returns the element at index k in sorted order, or End() when k is
+  // not less than Size(). It needs a ranked tree, as CountBelow() does
+  iterator Nth(size_type k) const {
+    static_assert(kRanked, "order statistics need a ranked tree");
+    if (k >= size_) return End();
+    // Select() leaves in k the index of the element within the node
+    Node *found = tree::Select(Root(), k);
+    return iterator(found, k);
+  }
+
+  // CountBelow() counts the elements less than key, or not greater than key
+  // when inclusive is set, by adding up left subtrees along one descent
+  template <typename K>
+  size_type CountBelow(const K &key, bool inclusive) const {
+    static_assert(kRanked, "order statistics need a ranked tree");
+    size_type result = 0;
+    for (Node *current = Root(); current;) {
+      if (inclusive ? !compare_(key, Key(current))
+                    : compare_(Key(current), key)) {
+        result += tree::Count(current->left_) + tree::Weight(current);
+        current = current->right_;
+      } else {
+        current = current->left_;
+      }
+    }
+    return result;
+  }
+
+  // NodeOf() gives the containers the node behind an iterator, e.g. for
+  // Map to reach the mapped value
+  static Node *NodeOf(iterator pos) { return pos.ptr_; }
+
+ private:
+  using node_traits = std::allocator_traits<node_allocator>;
+
+  template <typename... Args>
+  Node *NewNode(Args &&...args) {
+    Node *result = node_traits::allocate(node_alloc_, 1);
+    try {
+      node_traits::construct(node_alloc_, result, std::forward<Args>(args)...);
+    } catch (...) {
+      node_traits::deallocate(node_alloc_, result, 1);
+      throw;
+    }
+    return result;
+  }
+
+  void DeleteNode(Node *node) {
+    node_traits::destroy(node_alloc_, node);
+    node_traits::deallocate(node_alloc_, node, 1);
+  }
+
+  Node *Root() const { return header_->left_; }
+
+  static const auto &Key(const Node *node) { return KeyOf()(node->value_); }
+
+  // StoreSize() copies the size into the key of the header, where
+  // dereferencing end() finds it as with std::set. Only arithmetic keys that
+  // are not const in the element hold it, the header of other trees keeps its
+  // value-initialized element
+  void StoreSize() {
+    using key_type = std::remove_cv_t<
+        std::remove_reference_t<decltype(Key(header_))>>;
+    if constexpr (std::is_arithmetic_v<key_type> &&
+                  !kConstKey<typename Node::value_type>) {
+      const_cast<key_type &>(Key(header_)) = static_cast<key_type>(size_);
+    }
+  }
+
+  // DeleteNodes() frees a subtree without recursion: left children are
+  // rotated up until the current node has none, then it is freed and the
+  // walk moves on to its right child
+  void DeleteNodes(Node *node) {
+    while (node) {
+      if (node->left_) {
+        Node *left = node->left_;
+        node->left_ = left->right_;
+        left->right_ = node;
+        node = left;
+      } else {
+        Node *right = node->right_;
+        DeleteNode(node);
+        node = right;
+      }
+    }
+  }
+
+  Node *CheckedNode(iterator pos) const {
+    if (pos.ptr_ == header_) {
+      throw std::logic_error(
+          "The end() iterator cannot be used as a value for pos\n");
+    }
+    return pos.ptr_;
+  }
+
+  // InOrder() checks whether an element keyed one may be placed right before
+  // an element keyed two: strictly less for kUnique, not greater otherwise
+  template <typename A, typename B>
+  bool InOrder(const A &one, const B &two) const {
+    if constexpr (kUnique) {
+      return compare_(one, two);
+    } else {
+      return !compare_(two, one);
+    }
+  }
+
+  // InsertPosition() stores where a node keyed key has to be linked, after
+  // the elements equal to it. With kUnique it returns the node holding key
+  // instead when there is one, and nullptr otherwise
+  template <typename K>
+  Node *InsertPosition(const K &key, Node *&parent, bool &left) const {
+    parent = header_;
+    left = true;
+    for (Node *current = Root(); current;) {
+      parent = current;
+      left = compare_(key, Key(current));
+      if constexpr (kUnique) {
+        if (!left && !compare_(Key(current), key)) return current;
+      }
+      current = left ? current->left_ : current->right_;
+    }
+    return nullptr;
+  }
+
+  // HintPosition() is InsertPosition() for a hinted insert. When key belongs
+  // right before or right after hint, the position is found from hint and
+  // its neighbour without descending from the root
+  template <typename K>
+  Node *HintPosition(Node *hint, const K &key, Node *&parent,
+                     bool &left) const {
+    if (hint == header_) {
+      if (size_ && InOrder(Key(rightmost_), key)) {
+        parent = rightmost_;
+        left = false;
+        return nullptr;
+      }
+    } else if (InOrder(key, Key(hint))) {
+      Node *before = hint == leftmost_ ? nullptr : hint->PreviousNode();
+      if (!before || InOrder(Key(before), key)) {
+        // hint has no left child exactly when before is above it
+        left = !hint->left_;
+        parent = left ? hint : before;
+        return nullptr;
+      }
+    } else if (kUnique && !compare_(Key(hint), key)) {
+      return hint;
+    } else {
+      Node *after = hint == rightmost_ ? nullptr : hint->NextNode();
+      if (!after || InOrder(key, Key(after))) {
+        left = hint->right_ != nullptr;
+        parent = left ? after : hint;
+        return nullptr;
+      }
+    }
+    return InsertPosition(key, parent, left);
+  }
+
+  template <typename K>
+  Node *Position(Node *hint, const K &key, Node *&parent, bool &left) const {
+    return hint ? HintPosition(hint, key, parent, left)
+                : InsertPosition(key, parent, left);
+  }
+
+  // LinkNode() links node where InsertPosition() said and keeps the size and
+  // the first and last nodes up to date; UnlinkNode() undoes it without
+  // freeing node
+  void LinkNode(Node *node, Node *parent, bool left) {
+    if (parent == header_) {
+      leftmost_ = rightmost_ = node;
+    } else if (left && parent == leftmost_) {
+      leftmost_ = node;
+    } else if (!left && parent == rightmost_) {
+      rightmost_ = node;
+    }
+    tree::InsertNode(node, parent, left, header_);
+    size_ += tree::Weight(node);
+    StoreSize();
+  }
+
+  void UnlinkNode(Node *node) {
+    if (node == leftmost_) leftmost_ = node->NextNode();
+    if (node == rightmost_) rightmost_ = node->PreviousNode();
+    tree::EraseNode(node, header_);
+    size_ -= tree::Weight(node);
+    StoreSize();
+  }
+
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> EmplaceAt(Node *hint, const K &key,
+                                      Args &&...args) {
+    Node *parent;
+    bool left;
+    Node *found = Position(hint, key, parent, left);
+    if (found) return std::make_pair(iterator(found), false);
+    iterator joined = JoinEqual(key, parent, left, 1);
+    if (joined.ptr_) return std::make_pair(joined, true);
+    Node *temp = NewNode(std::in_place, std::forward<Args>(args)...);
+    LinkNode(temp, parent, left);
+    return std::make_pair(iterator(temp), true);
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> EmplaceValueAt(Node *hint, Args &&...args) {
+    Node *temp = NewNode(std::in_place, std::forward<Args>(args)...);
+    Node *parent;
+    bool left;
+    Node *found;
+    iterator joined;
+    try {
+      found = Position(hint, Key(temp), parent, left);
+      if (!found) joined = JoinEqual(Key(temp), parent, left, 1);
+    } catch (...) {
+      DeleteNode(temp);
+      throw;
+    }
+    if (found || joined.ptr_) {
+      DeleteNode(temp);
+      return found ? std::make_pair(iterator(found), false)
+                   : std::make_pair(joined, true);
+    }
+    LinkNode(temp, parent, left);
+    return std::make_pair(iterator(temp), true);
+  }
+
+  // InsertEach() inserts a range one element at a time, each hinted at the
+  // end so a sorted tail costs O(1) per element
+  template <typename InputIt>
+  void InsertEach(InputIt first, InputIt last) {
+    for (; first != last; ++first) {
+      const auto &value = *first;
+      EmplaceAt(header_, KeyOf()(value), value);
+    }
+  }
+
+  std::pair<iterator, bool> ReinsertAt(Node *hint, node_handle &handle) {
+    if (handle.empty()) return std::make_pair(End(), false);
+    Node *parent;
+    bool left;
+    const auto &key = Key(handle.node_);
+    Node *found = Position(hint, key, parent, left);
+    if (found) return std::make_pair(iterator(found), false);
+    iterator joined =
+        JoinEqual(key, parent, left, tree::Weight(handle.node_));
+    if (joined.ptr_) {
+      handle.Reset();
+      return std::make_pair(joined, true);
+    }
+    Node *temp = AdoptNode(handle);
+    LinkNode(temp, parent, left);
+    return std::make_pair(iterator(temp), true);
+  }
+
+  // JoinEqual() adds copies elements keyed key to the run-length node next
+  // to the slot from InsertPosition() or HintPosition() that holds such
+  // elements, and returns an iterator to the first one added. It returns a
+  // null iterator when there is no such node or the nodes are not run-length
+  template <typename K>
+  iterator JoinEqual([[maybe_unused]] const K &key,
+                     [[maybe_unused]] Node *parent, [[maybe_unused]] bool left,
+                     [[maybe_unused]] size_type copies) {
+    if constexpr (kRunLength) {
+      if (parent == header_) return iterator();
+      // the elements equal to key are right before or right after the slot
+      Node *before = parent;
+      Node *after = parent;
+      if (left) {
+        before = parent == leftmost_ ? nullptr : parent->PreviousNode();
+      } else {
+        after = parent == rightmost_ ? nullptr : parent->NextNode();
+      }
+      Node *equal = nullptr;
+      if (before && !compare_(Key(before), key)) {
+        equal = before;
+      } else if (after && !compare_(key, Key(after))) {
+        equal = after;
+      }
+      if (!equal) return iterator();
+      equal->copies_ += copies;
+      tree::AddToCounts(equal, header_, copies);
+      size_ += copies;
+      StoreSize();
+      return iterator(equal, equal->copies_ - copies);
+    } else {
+      return iterator();
+    }
+  }
+
+  // RemoveCopy() drops one element of a node holding several
+  void RemoveCopy([[maybe_unused]] Node *node) {
+    if constexpr (kRunLength) {
+      --node->copies_;
+      tree::RemoveFromCounts(node, header_, 1);
+      --size_;
+      StoreSize();
+    }
+  }
+
+  // CopyNode() allocates an unlinked copy of a node with all its elements
+  Node *CopyNode(const Node *from) {
+    Node *result = NewNode(std::in_place, from->value_);
+    if constexpr (kRunLength) result->copies_ = from->copies_;
+    return result;
+  }
+
+  // AdoptNode() takes the node out of handle. It is copied only when the
+  // allocators differ, as Merge() does
+  Node *AdoptNode(node_handle &handle) {
+    if (*handle.alloc_ == node_alloc_) return handle.Release();
+    Node *result = CopyNode(handle.node_);
+    handle.Reset();
+    return result;
+  }
+
+  // CopyTreeFrom() clones the tree of other into this empty tree; Clone()
+  // copies the counts and copies_ along with the shape
+  void CopyTreeFrom(const RbTree &other) {
+    tree::Clone(other.header_, header_, [this](const Node *from) {
+      return NewNode(std::in_place, from->value_);
+    });
+    if (Root()) {
+      leftmost_ = Root()->FarLeft();
+      rightmost_ = Root()->FarRight();
+    }
+    size_ = other.size_;
+    StoreSize();
+  }
+
+  template <typename K>
+  Node *LowerBoundNode(const K &key) const {
+    Node *result = header_;
+    for (Node *current = Root(); current;) {
+      if (compare_(Key(current), key)) {
+        current = current->right_;
+      } else {
+        result = current;
+        current = current->left_;
+      }
+    }
+    return result;
+  }
+
+  template <typename K>
+  Node *UpperBoundNode(const K &key) const {
+    Node *result = header_;
+    for (Node *current = Root(); current;) {
+      if (compare_(key, Key(current))) {
+        result = current;
+        current = current->left_;
+      } else {
+        current = current->right_;
+      }
+    }
+    return result;
+  }
+
+  Node *header_;
+  // leftmost_ and rightmost_ are the first and the last node, or header_
+  // when the tree is empty
+  Node *leftmost_;
+  Node *rightmost_;
+  size_type size_ = 0;
+  Compare compare_;
+  node_allocator node_alloc_;
+};
+}  // namespace tree
+}  // namespace s21
+
+#endif  // SRC_S21_RB_TREE_H_
@@ -0,0 +1,275 @@
+#ifndef SRC_S21_SMALL_VECTOR_H_
+#define SRC_S21_SMALL_VECTOR_H_
+
+#include "s21_vector.h"
+
+namespace s21 {
+// InlineGrowth is the growth policy of small_vector: any storage request that
+// fits into the inline buffer takes the whole buffer, larger ones grow the
+// heap storage with the Growth policy
+template <std::size_t N, typename Growth = GeometricGrowth<>>
+struct InlineGrowth {
+  static std::size_t NextCapacity(std::size_t capacity, std::size_t required) {
+    return required <= N ? N : Growth::NextCapacity(capacity, required);
+  }
+};
+
+// Raw storage for the first N elements of a small_vector
+template <typename T, std::size_t N>
+struct InlineBuffer {
+  alignas(T) unsigned char storage_[N * sizeof(T)];
+  bool in_use_ = false;
+};
+
+// InlineBufferAllocator hands out the inline buffer of its small_vector for
+// requests of up to N elements while the buffer is free and falls back to the
+// upstream allocator otherwise. Two allocators compare equal when they can
+// free each other's memory: they share the buffer or none of their buffers is
+// in use, so a vector on the heap can still adopt another one's storage
+template <typename T, std::size_t N, typename Alloc = std::allocator<T>>
+class InlineBufferAllocator {
+ public:
+  using value_type = T;
+  using buffer_type = InlineBuffer<T, N>;
+  using propagate_on_container_copy_assignment = std::false_type;
+  using propagate_on_container_move_assignment = std::false_type;
+  using propagate_on_container_swap = std::false_type;
+  using is_always_equal = std::false_type;
+
+  explicit InlineBufferAllocator(buffer_type *buffer = nullptr,
+                                 const Alloc &upstream = Alloc())
+      : buffer_(buffer), upstream_(upstream) {}
+
+  T *allocate(std::size_t n) {
+    if (buffer_ && !buffer_->in_use_ && n <= N) {
+      buffer_->in_use_ = true;
+      return reinterpret_cast<T *>(buffer_->storage_);
+    }
+    return std::allocator_traits<Alloc>::allocate(upstream_, n);
+  }
+
+  void deallocate(T *ptr, std::size_t n) {
+    if (IsInline(ptr)) {
+      buffer_->in_use_ = false;
+    } else {
+      std::allocator_traits<Alloc>::deallocate(upstream_, ptr, n);
+    }
+  }
+
+  // A copy made by a plain vector copy has no buffer of its own
+  InlineBufferAllocator select_on_container_copy_construction() const {
+    return InlineBufferAllocator(nullptr, upstream_);
+  }
+
+  bool IsInline(const T *ptr) const {
+    return buffer_ && ptr == reinterpret_cast<const T *>(buffer_->storage_);
+  }
+
+  friend bool operator==(const InlineBufferAllocator &one,
+                         const InlineBufferAllocator &two) {
+    if (one.buffer_ == two.buffer_) return true;
+    return !one.BufferInUse() && !two.BufferInUse() &&
+           one.upstream_ == two.upstream_;
+  }
+
+  friend bool operator!=(const InlineBufferAllocator &one,
+                         const InlineBufferAllocator &two) {
+    return !(one == two);
+  }
+
+ private:
+  bool BufferInUse() const { return buffer_ && buffer_->in_use_; }
+
+  buffer_type *buffer_;
+  Alloc upstream_;
+};
+
+// small_vector is a vector that keeps up to N elements inside the object and
+// only allocates once it outgrows them. It offers every member of s21::vector,
+// but is not one: a vector moved out of it would keep pointing into the
+// inline buffer, so the base is private
+template <typename T, std::size_t N, typename Alloc = std::allocator<T>>
+class small_vector
+    : private InlineBuffer<T, N>,
+      private vector<T, InlineBufferAllocator<T, N, Alloc>, InlineGrowth<N>> {
+  static_assert(N > 0, "small_vector needs a non-empty inline buffer");
+
+  // kNothrowMove is set when a move cannot throw: inline elements are moved
+  // one by one, and heap storage is adopted without allocating whenever the
+  // upstream allocators compare equal
+  static constexpr bool kNothrowMove =
+      std::is_nothrow_move_constructible_v<T> &&
+      std::allocator_traits<Alloc>::is_always_equal::value;
+
+ public:
+  // Small vector Member type
+  using vector_type =
+      vector<T, InlineBufferAllocator<T, N, Alloc>, InlineGrowth<N>>;
+  using typename vector_type::allocator_type;
+  using typename vector_type::const_iterator;
+  using typename vector_type::const_pointer;
+  using typename vector_type::const_reference;
+  using typename vector_type::ConstIterator;
+  using typename vector_type::growth_policy;
+  using typename vector_type::iterator;
+  using typename vector_type::Iterator;
+  using typename vector_type::pointer;
+  using typename vector_type::reference;
+  using typename vector_type::size_type;
+  using typename vector_type::value_type;
+
+  // Small vector Member functions
+  small_vector();
+  explicit small_vector(size_type num);
+  small_vector(std::initializer_list<value_type> const &items);
+  small_vector(const small_vector &other);
+  small_vector(small_vector &&other) noexcept(kNothrowMove);
+  ~small_vector() = default;
+  small_vector &operator=(const small_vector &other);
+  small_vector &operator=(small_vector &&other) noexcept(kNothrowMove);
+
+  // Small vector members shared with vector
+  using vector_type::at;
+  using vector_type::back;
+  using vector_type::begin;
+  using vector_type::capacity;
+  using vector_type::clear;
+  using vector_type::data;
+  using vector_type::emplace;
+  using vector_type::emplace_back;
+  using vector_type::empty;
+  using vector_type::end;
+  using vector_type::erase;
+  using vector_type::front;
+  using vector_type::get_allocator;
+  using vector_type::insert;
+  using vector_type::max_size;
+  using vector_type::operator[];
+  using vector_type::pop_back;
+  using vector_type::push_back;
+  using vector_type::reallocations;
+  using vector_type::reserve;
+  using vector_type::size;
+
+  // Small vector Capacity
+  // inline_capacity() returns how many elements fit without a heap allocation
+  static constexpr size_type inline_capacity();
+  // is_inline() checks whether the elements are kept inside the object
+  bool is_inline() const;
+  // shrink_to_fit() moves the elements back inline when they fit there
+  void shrink_to_fit();
+
+  // Small vector Modifiers
+  // swap() swaps the contents, inline elements are moved one by one
+  void swap(small_vector &other);
+
+ private:
+  void CopyElementsFrom(const small_vector &other);
+  void MoveElementsFrom(small_vector &other);
+};
+
+template <typename T, std::size_t N, typename Alloc>
+small_vector<T, N, Alloc>::small_vector()
+    : vector_type(allocator_type(static_cast<InlineBuffer<T, N> *>(this))) {
+  this->reserve(N);
+}
+
+template <typename T, std::size_t N, typename Alloc>
+small_vector<T, N, Alloc>::small_vector(size_type num) : small_vector() {
+  this->reserve(num);
+  for (size_type i = 0; i < num; ++i) this->emplace_back();
+}
+
+template <typename T, std::size_t N, typename Alloc>
+small_vector<T, N, Alloc>::small_vector(
+    std::initializer_list<value_type> const &items)
+    : small_vector() {
+  this->insert(this->end(), items.begin(), items.end());
+}
+
+template <typename T, std::size_t N, typename Alloc>
+small_vector<T, N, Alloc>::small_vector(const small_vector &other)
+    : small_vector() {
+  CopyElementsFrom(other);
+}
+
+template <typename T, std::size_t N, typename Alloc>
+small_vector<T, N, Alloc>::small_vector(small_vector &&other) noexcept(
+    kNothrowMove)
+    : small_vector() {
+  MoveElementsFrom(other);
+}
+
+template <typename T, std::size_t N, typename Alloc>
+small_vector<T, N, Alloc> &small_vector<T, N, Alloc>::operator=(
+    const small_vector &other) {
+  if (this != &other) {
+    this->clear();
+    CopyElementsFrom(other);
+  }
+  return *this;
+}
+
+template <typename T, std::size_t N, typename Alloc>
+small_vector<T, N, Alloc> &small_vector<T, N, Alloc>::operator=(
+    small_vector &&other) noexcept(kNothrowMove) {
+  if (this != &other) {
+    this->clear();
+    MoveElementsFrom(other);
+  }
+  return *this;
+}
+
+template <typename T, std::size_t N, typename Alloc>
+constexpr typename small_vector<T, N, Alloc>::size_type
+small_vector<T, N, Alloc>::inline_capacity() {
+  return N;
+}
+
+template <typename T, std::size_t N, typename Alloc>
+bool small_vector<T, N, Alloc>::is_inline() const {
+  return this->get_allocator().IsInline(this->data());
+}
+
+template <typename T, std::size_t N, typename Alloc>
+void small_vector<T, N, Alloc>::shrink_to_fit() {
+  if (!is_inline()) vector_type::shrink_to_fit();
+}
+
+template <typename T, std::size_t N, typename Alloc>
+void small_vector<T, N, Alloc>::swap(small_vector &other) {
+  if (!is_inline() && !other.is_inline()) {
+    vector_type::swap(other);
+  } else {
+    small_vector temp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(temp);
+  }
+}
+
+// CopyElementsFrom() appends copies of the elements of other
+template <typename T, std::size_t N, typename Alloc>
+void small_vector<T, N, Alloc>::CopyElementsFrom(const small_vector &other) {
+  this->reserve(this->size() + other.size());
+  for (size_type i = 0; i < other.size(); ++i) this->push_back(other[i]);
+}
+
+// MoveElementsFrom() adopts the heap storage of other when it has one and
+// moves the elements one by one when they are inline. *this must be empty
+template <typename T, std::size_t N, typename Alloc>
+void small_vector<T, N, Alloc>::MoveElementsFrom(small_vector &other) {
+  if (other.is_inline()) {
+    this->reserve(other.size());
+    for (auto &item : other) this->emplace_back(std::move(item));
+    other.clear();
+  } else {
+    // releasing the inline buffer makes both allocators equal, so the vector
+    // move assignment takes the heap storage over without copying
+    vector_type::shrink_to_fit();
+    vector_type::operator=(std::move(other));
+  }
+}
+
+}  // namespace s21
+
+#endif  // SRC_S21_SMALL_VECTOR_H_
@@ -0,0 +1,484 @@
+#ifndef SRC_S21_TREE_H_
+#define SRC_S21_TREE_H_
+
+// Red-black tree algorithms behind tree::RbTree (s21_rb_tree.h). They work on
+// any node with top_, left_, right_ and color_ members. Every tree has a
+// header node (which is also end()) whose left_ is the root and whose right_
+// stays null, so the root is an ordinary left child and no algorithm has to
+// special-case it
+
+namespace s21 {
+enum class NodeColor { kRed, kBlack };
+
+// Tags for the range constructors of the tree containers: assume_sorted
+// promises that the range is sorted, assume_unique that it is sorted and has
+// no equivalent keys, so the containers skip the matching checks
+struct assume_sorted_t {
+  explicit assume_sorted_t() = default;
+};
+struct assume_unique_t {
+  explicit assume_unique_t() = default;
+};
+inline constexpr assume_sorted_t assume_sorted{};
+inline constexpr assume_unique_t assume_unique{};
+
+namespace tree {
+// IfTransparent<Compare, K> is K when Compare declares is_transparent and
+// ill-formed otherwise, so lookup overloads taking any key type the comparator
+// accepts only exist for such comparators
+template <typename Compare, typename K, typename = void>
+struct TransparentKey {};
+
+template <typename Compare, typename K>
+struct TransparentKey<Compare, K,
+                      std::void_t<typename Compare::is_transparent>> {
+  using type = K;
+};
+
+template <typename Compare, typename K>
+using IfTransparent = typename TransparentKey<Compare, K>::type;
+
+// NodeCount<true> is a base for nodes that keep the number of elements in
+// their subtree, which every algorithm below then maintains. NodeCount<false>
+// adds nothing
+template <bool kCounted>
+struct NodeCount {};
+
+template <>
+struct NodeCount<true> {
+  std::size_t count_ = 1;
+};
+
+// NodeCopies<true> is a base for nodes that hold several equal elements, as
+// many as copies_. NodeCopies<false> adds nothing and a node holds one
+template <bool kRunLength>
+struct NodeCopies {};
+
+template <>
+struct NodeCopies<true> {
+  std::size_t copies_ = 1;
+};
+
+template <typename Node>
+inline constexpr bool kIsCounted = std::is_base_of_v<NodeCount<true>, Node>;
+
+template <typename Node>
+inline constexpr bool kHasCopies = std::is_base_of_v<NodeCopies<true>, Node>;
+
+// Weight() returns the number of elements node holds
+template <typename Node>
+std::size_t Weight(const Node *node) {
+  if constexpr (kHasCopies<Node>) {
+    return node->copies_;
+  } else {
+    return 1;
+  }
+}
+
+// Count() returns the number of elements in the subtree of a counted node
+template <typename Node>
+std::size_t Count(const Node *node) {
+  return node ? node->count_ : 0;
+}
+
+// Recount() sets the count of node from its children
+template <typename Node>
+void Recount(Node *node) {
+  if constexpr (kIsCounted<Node>) {
+    node->count_ = Count(node->left_) + Count(node->right_) + Weight(node);
+  }
+}
+
+// AddToCounts() and RemoveFromCounts() change the counts from node up to the
+// root by delta elements
+template <typename Node>
+void AddToCounts(Node *node, Node *header, std::size_t delta) {
+  if constexpr (kIsCounted<Node>) {
+    for (; node != header; node = node->top_) node->count_ += delta;
+  }
+}
+
+template <typename Node>
+void RemoveFromCounts(Node *node, Node *header, std::size_t delta) {
+  if constexpr (kIsCounted<Node>) {
+    for (; node != header; node = node->top_) node->count_ -= delta;
+  }
+}
+
+// Select() returns the node holding the element at index k in the subtree of
+// a counted node and leaves in k the index of that element within the node;
+// k has to be less than the number of elements in the subtree
+template <typename Node>
+Node *Select(Node *node, std::size_t &k) {
+  while (true) {
+    std::size_t left = Count(node->left_);
+    if (k < left) {
+      node = node->left_;
+    } else if (k - left < Weight(node)) {
+      k -= left;
+      return node;
+    } else {
+      k -= left + Weight(node);
+      node = node->right_;
+    }
+  }
+}
+
+template <typename Node>
+bool IsBlack(const Node *node) {
+  return !node || node->color_ == NodeColor::kBlack;
+}
+
+// ReplaceChild() makes to take the place of from under parent
+template <typename Node>
+void ReplaceChild(Node *parent, Node *from, Node *to) {
+  if (parent->left_ == from) {
+    parent->left_ = to;
+  } else {
+    parent->right_ = to;
+  }
+}
+
+template <typename Node>
+void RotateLeft(Node *node) {
+  Node *child = node->right_;
+  node->right_ = child->left_;
+  if (child->left_) child->left_->top_ = node;
+  child->top_ = node->top_;
+  ReplaceChild(node->top_, node, child);
+  child->left_ = node;
+  node->top_ = child;
+  if constexpr (kIsCounted<Node>) {
+    child->count_ = node->count_;
+    Recount(node);
+  }
+}
+
+template <typename Node>
+void RotateRight(Node *node) {
+  Node *child = node->left_;
+  node->left_ = child->right_;
+  if (child->right_) child->right_->top_ = node;
+  child->top_ = node->top_;
+  ReplaceChild(node->top_, node, child);
+  child->right_ = node;
+  node->top_ = child;
+  if constexpr (kIsCounted<Node>) {
+    child->count_ = node->count_;
+    Recount(node);
+  }
+}
+
+// InsertNode() links node as the left or right child of parent (the header
+// for an empty tree) and restores the red-black properties
+template <typename Node>
+void InsertNode(Node *node, Node *parent, bool left, Node *header) {
+  node->top_ = parent;
+  node->left_ = node->right_ = nullptr;
+  node->color_ = NodeColor::kRed;
+  if constexpr (kIsCounted<Node>) node->count_ = Weight(node);
+  if (left) {
+    parent->left_ = node;
+  } else {
+    parent->right_ = node;
+  }
+  AddToCounts(parent, header, Weight(node));
+  while (node != header->left_ && node->top_->color_ == NodeColor::kRed) {
+    // a red parent is never the root, so the grandparent is a real node
+    Node *top = node->top_;
+    Node *grand = top->top_;
+    Node *uncle = top == grand->left_ ? grand->right_ : grand->left_;
+    if (!IsBlack(uncle)) {
+      top->color_ = uncle->color_ = NodeColor::kBlack;
+      grand->color_ = NodeColor::kRed;
+      node = grand;
+      continue;
+    }
+    if (top == grand->left_) {
+      if (node == top->right_) {
+        RotateLeft(top);
+        top = node;
+      }
+      RotateRight(grand);
+    } else {
+      if (node == top->left_) {
+        RotateRight(top);
+        top = node;
+      }
+      RotateLeft(grand);
+    }
+    top->color_ = NodeColor::kBlack;
+    grand->color_ = NodeColor::kRed;
+    break;
+  }
+  header->left_->color_ = NodeColor::kBlack;
+}
+
+// EraseNode() unlinks node from the tree and restores the red-black
+// properties. Other nodes are relinked, never copied, so iterators to them
+// stay valid
+template <typename Node>
+void EraseNode(Node *node, Node *header) {
+  Node *child = nullptr;
+  Node *parent = nullptr;
+  NodeColor removed = node->color_;
+  if (node->left_ && node->right_) {
+    // the successor takes node's place and color
+    Node *next = node->right_;
+    while (next->left_) next = next->left_;
+    if constexpr (kIsCounted<Node>) {
+      // the path down to next loses next, the rest of the path loses node
+      for (Node *top = next->top_; top != node; top = top->top_) {
+        top->count_ -= Weight(next);
+      }
+      RemoveFromCounts(node->top_, header, Weight(node));
+    }
+    removed = next->color_;
+    child = next->right_;
+    if (next == node->right_) {
+      parent = next;
+    } else {
+      parent = next->top_;
+      if (child) child->top_ = parent;
+      parent->left_ = child;
+      next->right_ = node->right_;
+      next->right_->top_ = next;
+    }
+    next->left_ = node->left_;
+    next->left_->top_ = next;
+    ReplaceChild(node->top_, node, next);
+    next->top_ = node->top_;
+    next->color_ = node->color_;
+    if constexpr (kIsCounted<Node>) next->count_ = node->count_ - Weight(node);
+  } else {
+    child = node->left_ ? node->left_ : node->right_;
+    parent = node->top_;
+    RemoveFromCounts(parent, header, Weight(node));
+    if (child) child->top_ = parent;
+    ReplaceChild(parent, node, child);
+  }
+  if (removed == NodeColor::kRed) return;
+  // child carries an extra black that is pushed up until it can be dropped
+  while (child != header->left_ && IsBlack(child)) {
+    if (child == parent->left_) {
+      Node *sibling = parent->right_;
+      if (!IsBlack(sibling)) {
+        sibling->color_ = NodeColor::kBlack;
+        parent->color_ = NodeColor::kRed;
+        RotateLeft(parent);
+        sibling = parent->right_;
+      }
+      if (IsBlack(sibling->left_) && IsBlack(sibling->right_)) {
+        sibling->color_ = NodeColor::kRed;
+        child = parent;
+        parent = parent->top_;
+        continue;
+      }
+      if (IsBlack(sibling->right_)) {
+        sibling->left_->color_ = NodeColor::kBlack;
+        sibling->color_ = NodeColor::kRed;
+        RotateRight(sibling);
+        sibling = parent->right_;
+      }
+      sibling->color_ = parent->color_;
+      parent->color_ = NodeColor::kBlack;
+      sibling->right_->color_ = NodeColor::kBlack;
+      RotateLeft(parent);
+    } else {
+      Node *sibling = parent->left_;
+      if (!IsBlack(sibling)) {
+        sibling->color_ = NodeColor::kBlack;
+        parent->color_ = NodeColor::kRed;
+        RotateRight(parent);
+        sibling = parent->left_;
+      }
+      if (IsBlack(sibling->left_) && IsBlack(sibling->right_)) {
+        sibling->color_ = NodeColor::kRed;
+        child = parent;
+        parent = parent->top_;
+        continue;
+      }
+      if (IsBlack(sibling->left_)) {
+        sibling->right_->color_ = NodeColor::kBlack;
+        sibling->color_ = NodeColor::kRed;
+        RotateLeft(sibling);
+        sibling = parent->left_;
+      }
+      sibling->color_ = parent->color_;
+      parent->color_ = NodeColor::kBlack;
+      sibling->left_->color_ = NodeColor::kBlack;
+      RotateRight(parent);
+    }
+    child = header->left_;
+  }
+  if (child) child->color_ = NodeColor::kBlack;
+}
+
+// Clone() copies the tree below source_header node for node under the empty
+// header, keeping shape and colors, so no key is compared. make(node) returns
+// a new node holding a copy of node's value. Nodes are linked as soon as they
+// are made, so if make() throws the partial copy is still a tree the caller
+// can free. The walk follows parent links and needs no stack
+template <typename Node, typename Make>
+void Clone(const Node *source_header, Node *header, Make make) {
+  const Node *from = source_header;
+  Node *to = header;
+  while (true) {
+    const Node *next = nullptr;
+    Node **link = nullptr;
+    if (from->left_ && !to->left_) {
+      next = from->left_;
+      link = &to->left_;
+    } else if (from->right_ && !to->right_) {
+      next = from->right_;
+      link = &to->right_;
+    } else if (from == source_header) {
+      break;
+    } else {
+      from = from->top_;
+      to = to->top_;
+      continue;
+    }
+    Node *node = make(next);
+    node->top_ = to;
+    node->left_ = node->right_ = nullptr;
+    node->color_ = next->color_;
+    if constexpr (kIsCounted<Node>) node->count_ = next->count_;
+    if constexpr (kHasCopies<Node>) node->copies_ = next->copies_;
+    *link = node;
+    from = next;
+    to = node;
+  }
+}
+
+// BuildBalanced() turns the first size nodes of list, a chain of sorted nodes
+// linked through right_, into a tree whose subtree sizes differ by at most
+// one, so every level but the deepest is full. Only the deepest level is
+// colored red, and only when it is not full
+template <typename Node>
+Node *BuildBalanced(Node *&list, std::size_t size, std::size_t depth,
+                    std::size_t red_depth) {
+  if (!size) return nullptr;
+  std::size_t left_size = (size - 1) / 2;
+  Node *left = BuildBalanced(list, left_size, depth + 1, red_depth);
+  Node *node = list;
+  list = list->right_;
+  node->left_ = left;
+  if (left) left->top_ = node;
+  Node *right = BuildBalanced(list, size - 1 - left_size, depth + 1, red_depth);
+  node->right_ = right;
+  if (right) right->top_ = node;
+  node->color_ = depth == red_depth ? NodeColor::kRed : NodeColor::kBlack;
+  Recount(node);
+  return node;
+}
+
+// BuildSorted() makes the size nodes of list the tree of the empty header in
+// O(n) time and O(log n) stack
+template <typename Node>
+void BuildSorted(Node *list, std::size_t size, Node *header) {
+  std::size_t depth = 0;
+  while ((std::size_t(2) << depth) - 1 < size) ++depth;
+  std::size_t full = (std::size_t(2) << depth) - 1;
+  std::size_t red_depth = size == full ? depth + 1 : depth;
+  header->left_ = BuildBalanced(list, size, 0, red_depth);
+  if (header->left_) header->left_->top_ = header;
+}
+
+// NodeHandle owns a node extracted from a tree together with a copy of the
+// allocator that made it, and frees the node unless a container takes it
+// back. The containers derive their node_type from it to add accessors
+template <typename Node, typename Alloc>
+class NodeHandle {
+  template <typename, typename, typename, typename, bool>
+  friend class RbTree;
+
+ public:
+  using allocator_type = Alloc;
+
+  NodeHandle() = default;
+
+  NodeHandle(NodeHandle &&other) noexcept
+      : node_(other.node_), alloc_(std::move(other.alloc_)) {
+    other.node_ = nullptr;
+    other.alloc_.reset();
+  }
+
+  NodeHandle &operator=(NodeHandle &&other) {
+    if (this != &other) {
+      Reset();
+      node_ = other.node_;
+      alloc_ = std::move(other.alloc_);
+      other.node_ = nullptr;
+      other.alloc_.reset();
+    }
+    return *this;
+  }
+
+  ~NodeHandle() { Reset(); }
+
+  // empty() checks whether the handle owns a node
+  bool empty() const { return !node_; }
+  explicit operator bool() const { return node_ != nullptr; }
+  // get_allocator() returns the allocator of the container the node came from
+  allocator_type get_allocator() const { return allocator_type(*alloc_); }
+
+  void swap(NodeHandle &other) {
+    std::swap(node_, other.node_);
+    std::swap(alloc_, other.alloc_);
+  }
+
+ protected:
+  using node_allocator =
+      typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
+  NodeHandle(Node *node, const node_allocator &alloc)
+      : node_(node), alloc_(alloc) {}
+
+  // Release() gives the node up without freeing it
+  Node *Release() {
+    Node *node = node_;
+    node_ = nullptr;
+    alloc_.reset();
+    return node;
+  }
+
+  void Reset() {
+    if (node_) {
+      node_traits::destroy(*alloc_, node_);
+      node_traits::deallocate(*alloc_, node_, 1);
+    }
+    node_ = nullptr;
+    alloc_.reset();
+  }
+
+  Node *node_ = nullptr;
+  // the allocator is optional as an empty handle has none to copy
+  std::optional<node_allocator> alloc_;
+};
+
+// Range is a view of the elements in [begin(), end()) of a tree container. It
+// holds two iterators and no elements, so range() hands out the nodes in a
+// key interval without copying or walking them
+template <typename Iterator>
+class Range {
+ public:
+  Range(Iterator first, Iterator last) : first_(first), last_(last) {}
+
+  Iterator begin() const { return first_; }
+  Iterator end() const { return last_; }
+  // empty() checks whether the range has no elements
+  bool empty() const {
+    Iterator first = first_;
+    return first == last_;
+  }
+
+ private:
+  Iterator first_;
+  Iterator last_;
+};
+}  // namespace tree
+}  // namespace s21
+
+#endif  // SRC_S21_TREE_H_
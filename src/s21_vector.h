@@ -1,77 +1,70 @@
 #ifndef SRC_S21_VECTOR_H_
 #define SRC_S21_VECTOR_H_
 
+#include "s21_iterator.h"
+
 namespace s21 {
-template <typename T>
+// is_trivially_relocatable tells vector that an object may be moved to new
+// storage with a plain memcpy and without calling its destructor. It holds for
+// trivially copyable types and can be specialized for types that only own
+// their resources through pointers (e.g. a pimpl or a unique_ptr wrapper)
+template <typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+// GeometricGrowth is the default growth policy of vector: when the storage is
+// full the capacity is multiplied by Num / Den, so appending n elements costs
+// O(log n) reallocations and amortized O(1) per push_back
+template <std::size_t Num = 2, std::size_t Den = 1>
+struct GeometricGrowth {
+  static_assert(Den > 0 && Num > Den, "Growth factor must be greater than 1");
+
+  // NextCapacity() returns the capacity to grow to from current capacity when
+  // at least required elements have to fit
+  static std::size_t NextCapacity(std::size_t capacity, std::size_t required) {
+    std::size_t result = capacity + capacity / Den * (Num - Den) +
+                         capacity % Den * (Num - Den) / Den;
+    return result < required ? required : result;
+  }
+};
+
+template <typename T, typename Alloc = std::allocator<T>,
+          typename Growth = GeometricGrowth<>>
 class vector {
  public:
-  class ConstIterator;
-
-  // Public class Iterator
-  class Iterator {
-    friend class vector;
-
-   public:
-    using pointer = T *;
-    using reference = T &;
-
-   public:
-    Iterator(pointer ptr);
-    Iterator &operator++();
-    Iterator operator++(int);
-    Iterator &operator--();
-    Iterator operator--(int);
-    bool operator==(const Iterator &other);
-    bool operator!=(const Iterator &other);
-    reference operator*();
-    operator ConstIterator() const;
-
-   private:
-    pointer ptr_;
-  };
-
-  // Public class ConstIterator
- public:
-  class ConstIterator {
-    friend class vector;
-
-   public:
-    using const_pointer = const T *;
-    using const_reference = const T &;
-
-   public:
-    ConstIterator(const_pointer ptr);
-    ConstIterator &operator++();
-    ConstIterator operator++(int);
-    ConstIterator &operator--();
-    ConstIterator operator--(int);
-    const_reference operator*() const;
-    bool operator==(const ConstIterator &other);
-    bool operator!=(const ConstIterator &other);
-
-   private:
-    const_pointer ptr_;
-  };
+  // Vector iterators are random access and wrap a plain pointer
+  using Iterator = ContiguousIterator<T, vector>;
+  using ConstIterator = ContiguousIterator<const T, vector>;
 
   // Vector Member type
   using value_type = T;
+  using allocator_type = Alloc;
   using pointer = value_type *;
   using const_pointer = const value_type *;
   using reference = T &;
   using const_reference = const T &;
   using iterator = Iterator;
-  using const_iterator = const ConstIterator;
+  using const_iterator = ConstIterator;
   using size_type = size_t;
+  using growth_policy = Growth;
 
   // Vector Member functions
   vector();
-  explicit vector(size_type num);
-  vector(std::initializer_list<value_type> const &items);
+  explicit vector(const allocator_type &alloc);
+  explicit vector(size_type num,
+                  const allocator_type &alloc = allocator_type());
+  vector(std::initializer_list<value_type> const &items,
+         const allocator_type &alloc = allocator_type());
   vector(const vector &other);
-  vector(vector &&other);
+  vector(const vector &other, const allocator_type &alloc);
+  vector(vector &&other) noexcept;
   ~vector();
   vector &operator=(const vector &other);
-  vector &operator=(vector &&other) noexcept;
+  vector &operator=(vector &&other) noexcept(
+      std::allocator_traits<Alloc>::propagate_on_container_move_assignment::
+          value ||
+      std::allocator_traits<Alloc>::is_always_equal::value);
+  // get_allocator() returns the allocator associated with the container
+  allocator_type get_allocator() const;
 
   // Vector Element access
   // at() access specified element with bounds checking
@@ -113,6 +106,8 @@ class vector {
   size_type capacity() const;
   // shrink_to_fit() reduces memory usage by freeing unused memory
   void shrink_to_fit();
+  // reallocations() returns how many times the storage has been reallocated
+  size_type reallocations() const;
 
   // Vector Modifiers
   // clear() clears the contents
@@ -120,416 +115,655 @@ class vector {
   // insert() inserts elements into concrete pos and returns the iterator that
   // points to the new element
   iterator insert(iterator pos, const_reference value);
-  // erase() erases element at pos
-  void erase(iterator pos);
+  iterator insert(iterator pos, value_type &&value);
+  template <typename InputIt>
+  iterator insert(iterator pos, InputIt first, InputIt last);
+  // erase() erases element at pos (or the range [first, last)) and returns
+  // the iterator following the last removed element
+  iterator erase(iterator pos);
+  iterator erase(iterator first, iterator last);
   // push_back() adds an element to the end
   void push_back(const_reference element);
+  void push_back(value_type &&element);
   // pop_back() removes the last element
   void pop_back();
-  // swap() swaps the contents
+  // swap() swaps the contents, the allocators are swapped only if they
+  // propagate on swap and must compare equal otherwise
   void swap(vector &other);
-  // emplace() inserts new elements into the container directly before pos
+  // emplace() constructs a new element from args in place directly before pos
   template <typename... Args>
   iterator emplace(const_iterator pos, Args &&...args);
-  // emplace_back() appends new elements to the end of the container
+  // emplace_back() constructs a new element from args in place at the end of
+  // the container
   template <typename... Args>
-  void emplace_back(Args &&...args);
+  reference emplace_back(Args &&...args);
 
  private:
+  using alloc_traits = std::allocator_traits<Alloc>;
+  // kRelocateByCopy is set when moving an element may throw, so relocation
+  // copies the elements and destroys the old ones only once all copies exist
+  static constexpr bool kRelocateByCopy =
+      !is_trivially_relocatable<T>::value &&
+      !std::is_nothrow_move_constructible_v<T> &&
+      std::is_copy_constructible_v<T>;
+
+  allocator_type alloc_;
   pointer vect_;
   size_type size_;
   size_type cap_;
+  size_type realloc_count_ = 0;
 
   // Vector Helper Methods
   void CopySwapWithStd(vector &one, vector &two) noexcept;
+  void StealStorage(vector &other) noexcept;
+  void FreeStorage() noexcept;
+  pointer Allocate(size_type n);
+  void ReplaceStorage(pointer newarr, size_type new_cap);
+  template <typename... Args>
+  void Construct(pointer where, Args &&...args);
+  void DestroyElements(pointer first, pointer last) noexcept;
+  size_type GrowCapacity(size_type required) const;
+  void RelocateElements(pointer from, size_type count, pointer to);
+  void RelocateAround(pointer newarr, size_type index, size_type count);
+  void Reallocate(size_type new_cap, size_type index, size_type count);
+  void OpenGap(size_type index, size_type count);
+  void CloseGap(size_type index, size_type count);
+  template <typename... Args>
+  void ReallocInsert(size_type index, Args &&...args);
 };
 
-// Iterator class implementation
-
-template <typename T>
-vector<T>::Iterator::Iterator(pointer ptr) : ptr_(ptr) {}
-
-template <typename T>
-typename vector<T>::Iterator &vector<T>::Iterator::operator++() {
-  ++ptr_;
-  return *this;
-}
-
-template <typename T>
-typename vector<T>::Iterator vector<T>::Iterator::operator++(int) {
-  Iterator temp = *this;
-  ++(*this);
-  return temp;
-}
-
-template <typename T>
-typename vector<T>::Iterator &vector<T>::Iterator::operator--() {
-  --ptr_;
-  return *this;
-}
-
-template <typename T>
-typename vector<T>::Iterator vector<T>::Iterator::operator--(int) {
-  Iterator temp = *this;
-  --(*this);
-  return temp;
-}
-
-template <typename T>
-bool vector<T>::Iterator::operator==(const Iterator &other) {
-  return ptr_ == other.ptr_;
-}
-
-template <typename T>
-bool vector<T>::Iterator::operator!=(const Iterator &other) {
-  return !(ptr_ == other.ptr_);
-}
-
-template <typename T>
-typename vector<T>::Iterator::reference vector<T>::Iterator::operator*() {
-  return *(this->ptr_);
-}
-
-template <typename T>
-vector<T>::Iterator::operator ConstIterator() const {
-  return ConstIterator(ptr_);
-}
-
-// ConstIterator class implementation
-
-template <typename T>
-vector<T>::ConstIterator::ConstIterator(const_pointer ptr) : ptr_(ptr) {}
-
-template <typename T>
-typename vector<T>::ConstIterator &vector<T>::ConstIterator::operator++() {
-  ++ptr_;
-  return *this;
-}
-
-template <typename T>
-typename vector<T>::ConstIterator vector<T>::ConstIterator::operator++(int) {
-  ConstIterator temp = *this;
-  ++(*this);
-  return temp;
-}
-
-template <typename T>
-typename vector<T>::ConstIterator &vector<T>::ConstIterator::operator--() {
-  --ptr_;
-  return *this;
-}
-
-template <typename T>
-typename vector<T>::ConstIterator vector<T>::ConstIterator::operator--(int) {
-  ConstIterator temp = *this;
-  --(*this);
-  return temp;
-}
-
-template <typename T>
-typename vector<T>::ConstIterator::const_reference
-vector<T>::ConstIterator::operator*() const {
-  return *(this->ptr_);
-}
-
-template <typename T>
-bool vector<T>::ConstIterator::operator==(const ConstIterator &other) {
-  return ptr_ == other.ptr_;
-}
-
-template <typename T>
-bool vector<T>::ConstIterator::operator!=(const ConstIterator &other) {
-  return !(ptr_ == other.ptr_);
-}
-
 // Vector class implementation
 
-template <typename T>
-vector<T>::vector() {
+template <typename T, typename Alloc, typename Growth>
+vector<T, Alloc, Growth>::vector() : vector(allocator_type()) {}
+
+template <typename T, typename Alloc, typename Growth>
+vector<T, Alloc, Growth>::vector(const allocator_type &alloc) : alloc_(alloc) {
   size_ = cap_ = 0;
   vect_ = nullptr;
 }
 
-template <typename T>
-vector<T>::vector(size_type num) {
+template <typename T, typename Alloc, typename Growth>
+vector<T, Alloc, Growth>::vector(size_type num, const allocator_type &alloc)
+    : vector(alloc) {
   if (num > max_size())
     throw std::length_error("Cannot create vector larger than max_size()");
-  size_ = cap_ = num;
-  vect_ = reinterpret_cast<pointer>(new int8_t[size_ * sizeof(value_type)]);
+  vect_ = Allocate(num);
+  cap_ = num;
+  for (; size_ < num; ++size_) Construct(vect_ + size_);
+}
+
+template <typename T, typename Alloc, typename Growth>
+vector<T, Alloc, Growth>::vector(std::initializer_list<value_type> const &items,
+                                 const allocator_type &alloc)
+    : vector(alloc) {
+  vect_ = Allocate(items.size());
+  cap_ = items.size();
+  for (auto ptr = items.begin(); ptr != items.end(); ++ptr, ++size_) {
+    Construct(vect_ + size_, *ptr);
+  }
 }
 
-template <typename T>
-vector<T>::vector(std::initializer_list<value_type> const &items)
-    : vector(items.size()) {
-  auto ptr = items.begin();
-  std::uninitialized_copy(ptr, ptr + items.size(), vect_);
-}
+template <typename T, typename Alloc, typename Growth>
+vector<T, Alloc, Growth>::vector(const vector &other)
+    : vector(other, alloc_traits::select_on_container_copy_construction(
+                        other.alloc_)) {}
 
-template <typename T>
-vector<T>::vector(const vector &other) {
-  size_ = other.size_;
-  cap_ = other.cap_;
-  vect_ = reinterpret_cast<pointer>(new int8_t[size_ * sizeof(value_type)]);
-  std::uninitialized_copy(other.vect_, other.vect_ + other.size_, vect_);
+template <typename T, typename Alloc, typename Growth>
+vector<T, Alloc, Growth>::vector(const vector &other,
+                                 const allocator_type &alloc)
+    : vector(alloc) {
+  vect_ = Allocate(other.size_);
+  cap_ = other.size_;
+  for (; size_ < other.size_; ++size_) Construct(vect_ + size_, other[size_]);
 }
 
-template <typename T>
-vector<T>::vector(vector &&other) {
-  CopySwapWithStd(*this, other);
-  other.size_ = other.cap_ = 0;
-  other.vect_ = nullptr;
+template <typename T, typename Alloc, typename Growth>
+vector<T, Alloc, Growth>::vector(vector &&other) noexcept
+    : vector(std::move(other.alloc_)) {
+  StealStorage(other);
 }
 
-template <typename T>
-vector<T>::~vector() {
-  clear();
-  delete[] reinterpret_cast<int8_t *>(vect_);
+template <typename T, typename Alloc, typename Growth>
+vector<T, Alloc, Growth>::~vector() {
+  FreeStorage();
 }
 
-template <typename T>
-typename vector<T>::vector &vector<T>::operator=(const vector &other) {
+template <typename T, typename Alloc, typename Growth>
+typename vector<T, Alloc, Growth>::vector &vector<T, Alloc, Growth>::operator=(
+    const vector &other) {
   if (this != &other) {
-    vector temp(other);
+    if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+      if (alloc_ != other.alloc_) FreeStorage();
+      alloc_ = other.alloc_;
+    }
+    vector temp(other, alloc_);
     CopySwapWithStd(*this, temp);
   }
   return *this;
 }
 
-template <typename T>
-typename vector<T>::vector &vector<T>::operator=(vector &&other) noexcept {
+template <typename T, typename Alloc, typename Growth>
+typename vector<T, Alloc, Growth>::vector &vector<T, Alloc, Growth>::operator=(
+    vector &&other) noexcept(
+    alloc_traits::propagate_on_container_move_assignment::value ||
+    alloc_traits::is_always_equal::value) {
   if (this != &other) {
-    vector temp(std::move(other));
-    CopySwapWithStd(*this, temp);
+    if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+      FreeStorage();
+      alloc_ = std::move(other.alloc_);
+      StealStorage(other);
+    } else if (alloc_ == other.alloc_) {
+      FreeStorage();
+      StealStorage(other);
+    } else {
+      // storage of another arena cannot be adopted, the elements are moved
+      vector temp(alloc_);
+      temp.reserve(other.size_);
+      for (size_type i = 0; i < other.size_; ++i) {
+        temp.emplace_back(std::move(other[i]));
+      }
+      CopySwapWithStd(*this, temp);
+    }
   }
   return *this;
 }
 
-template <typename T>
-typename vector<T>::reference vector<T>::at(size_type pos) {
+template <typename T, typename Alloc, typename Growth>
+typename vector<T, Alloc, Growth>::allocator_type
+vector<T, Alloc, Growth>::get_allocator() const {
+  return alloc_;
+}
+
+template <typename T, typename Alloc, typename Growth>
+typename vector<T, Alloc, Growth>::reference vector<T, Alloc, Growth>::at(
+    size_type pos) {
   if (pos >= size_) {
     throw std::out_of_range("Position is out_of_range\n");
   }
   return vect_[pos];
 }
 
-template <typename T>
-typename vector<T>::const_reference vector<T>::at(size_type pos) const {
+template <typename T, typename Alloc, typename Growth>
+typename vector<T, Alloc, Growth>::const_reference
+vector<T, Alloc, Growth>::at(size_type pos) const {
   if (pos >= size_) {
     throw std::out_of_range("Position is out_of_range\n");
   }
   return vect_[pos];
 }
 
-template <typename T>
-typename vector<T>::reference vector<T>::operator[](size_type pos) {
+template <typename T, typename Alloc, typename Growth>
+typename vector<T, Alloc, Growth>::reference
+vector<T, Alloc, Growth>::operator[](size_type pos) {
   return vect_[pos];
 }
 
-template <typename T>
-typename vector<T>::const_reference vector<T>::operator[](size_type pos) const {
+template <typename T, typename Alloc, typename Growth>
+typename vector<T, Alloc, Growth>::const_reference
+vector<T, Alloc, Growth>::operator[](size_type pos) const {
   return vect_[pos];
 }
 
-template <typename T>
-typename vector<T>::reference vector<T>::front() {
+template <typename T, typename Alloc, typename Growth>
+typename vector<T, Alloc, Growth>::reference vector<T, Alloc, Growth>::front() {
   return vect_[0];
 }
 
-template <typename T>
-typename vector<T>::const_reference vector<T>::front() const {
+template <typename T, typename Alloc, typename Growth>
+typename vector<T, Alloc, Growth>::const_reference
+vector<T, Alloc, Growth>::front() const {
   return vect_[0];
 }
 
-template <typename T>
-typename vector<T>::reference vector<T>::back() {
+template <typename T, typename Alloc, typename Growth>
+typename vector<T, Alloc, Growth>::reference vector<T, Alloc, Growth>::back() {
   return vect_[size_ - 1];
 }
 
-template <typename T>
-typename vector<T>::const_reference vector<T>::back() const {
+template <typename T, typename Alloc, typename Growth>
+typename vector<T, Alloc, Growth>::const_reference
+vector<T, Alloc, Growth>::back() const {
   return vect_[size_ - 1];
 }
 
-template <typename T>
-typename vector<T>::pointer vector<T>::data() {
+template <typename T, typename Alloc, typename Growth>
+typename vector<T, Alloc, Growth>::pointer vector<T, Alloc, Growth>::data() {
   return vect_;
 }
 
-template <typename T>
-typename vector<T>::const_pointer vector<T>::data() const {
+template <typename T, typename Alloc, typename Growth>
+typename vector<T, Alloc, Growth>::const_pointer
+vector<T, Alloc, Growth>::data() const {
   return vect_;
 }
 
-template <typename T>
-typename vector<T>::iterator vector<T>::begin() {
+template <typename T, typename Alloc, typename Growth>
+typename vector<T, Alloc, Growth>::iterator vector<T, Alloc, Growth>::begin() {
   return iterator(vect_);
 }
 
-template <typename T>
-typename vector<T>::const_iterator vector<T>::begin() const {
+template <typename T, typename Alloc, typename Growth>
+typename vector<T, Alloc, Growth>::const_iterator
+vector<T, Alloc, Growth>::begin() const {
   return const_iterator(vect_);
 }
 
-template <typename T>
-typename vector<T>::iterator vector<T>::end() {
+template <typename T, typename Alloc, typename Growth>
+typename vector<T, Alloc, Growth>::iterator vector<T, Alloc, Growth>::end() {
   return iterator(vect_ + size_);
 }
 
-template <typename T>
-typename vector<T>::const_iterator vector<T>::end() const {
+template <typename T, typename Alloc, typename Growth>
+typename vector<T, Alloc, Growth>::const_iterator
+vector<T, Alloc, Growth>::end() const {
   return const_iterator(vect_ + size_);
 }
 
-template <typename T>
-bool vector<T>::empty() const {
+template <typename T, typename Alloc, typename Growth>
+bool vector<T, Alloc, Growth>::empty() const {
   return size_ == 0;
 }
 
-template <typename T>
-typename vector<T>::size_type vector<T>::size() const {
+template <typename T, typename Alloc, typename Growth>
+typename vector<T, Alloc, Growth>::size_type vector<T, Alloc, Growth>::size()
+    const {
   return size_;
 }
 
-template <typename T>
-typename vector<T>::size_type vector<T>::max_size() const {
-  return SIZE_MAX / sizeof(value_type) / 2;
+template <typename T, typename Alloc, typename Growth>
+typename vector<T, Alloc, Growth>::size_type
+vector<T, Alloc, Growth>::max_size() const {
+  size_type result = SIZE_MAX / sizeof(value_type) / 2;
+  size_type alloc_max = alloc_traits::max_size(alloc_);
+  return alloc_max < result ? alloc_max : result;
 }
 
-template <typename T>
-void vector<T>::reserve(size_type n) {
+template <typename T, typename Alloc, typename Growth>
+void vector<T, Alloc, Growth>::reserve(size_type n) {
   if (n <= cap_) return;
-  pointer newarr =
-      reinterpret_cast<pointer>(new int8_t[n * sizeof(value_type)]);
-  std::uninitialized_copy(vect_, vect_ + size_, newarr);
-  for (size_type i = 0; i < size_; ++i) {
-    vect_[i].~value_type();
-  }
-  delete[] reinterpret_cast<int8_t *>(vect_);
-  vect_ = newarr;
-  cap_ = n;
+  if (n > max_size())
+    throw std::length_error("Cannot reserve more than max_size()");
+  Reallocate(n, size_, 0);
 }
 
-template <typename T>
-typename vector<T>::size_type vector<T>::capacity() const {
+template <typename T, typename Alloc, typename Growth>
+typename vector<T, Alloc, Growth>::size_type
+vector<T, Alloc, Growth>::capacity() const {
   return cap_;
 }
 
-template <typename T>
-void vector<T>::shrink_to_fit() {
-  if (cap_ > size_) {
-    pointer newarr =
-        reinterpret_cast<pointer>(new int8_t[size_ * sizeof(value_type)]);
-    std::uninitialized_copy(vect_, vect_ + size_, newarr);
-    delete[] reinterpret_cast<int8_t *>(vect_);
-    vect_ = newarr;
-    cap_ = size_;
-  }
+template <typename T, typename Alloc, typename Growth>
+void vector<T, Alloc, Growth>::shrink_to_fit() {
+  if (cap_ > size_) Reallocate(size_, size_, 0);
 }
 
-template <typename T>
-void vector<T>::clear() {
-  for (size_type i = 0; i < size_; ++i) {
-    vect_[i].~value_type();
-  }
+template <typename T, typename Alloc, typename Growth>
+typename vector<T, Alloc, Growth>::size_type
+vector<T, Alloc, Growth>::reallocations() const {
+  return realloc_count_;
+}
+
+template <typename T, typename Alloc, typename Growth>
+void vector<T, Alloc, Growth>::clear() {
+  DestroyElements(vect_, vect_ + size_);
   size_ = 0;
 }
 
-template <typename T>
-typename vector<T>::iterator vector<T>::insert(iterator pos,
-                                               const_reference value) {
-  if (size_ == 0) {
-    push_back(value);
-    return begin();
-  }
-  if (size_ + 1 <= cap_) {
-    vector<value_type> temp(*this);
-    *pos.ptr_ = value;
-    for (size_type i = pos.ptr_ - vect_, j = 1; i < size_; ++i, ++j) {
-      *(pos.ptr_ + j) = temp[i];
+template <typename T, typename Alloc, typename Growth>
+typename vector<T, Alloc, Growth>::iterator vector<T, Alloc, Growth>::insert(
+    iterator pos, const_reference value) {
+  return emplace(pos, value);
+}
+
+template <typename T, typename Alloc, typename Growth>
+typename vector<T, Alloc, Growth>::iterator vector<T, Alloc, Growth>::insert(
+    iterator pos, value_type &&value) {
+  return emplace(pos, std::move(value));
+}
+
+template <typename T, typename Alloc, typename Growth>
+template <typename InputIt>
+typename vector<T, Alloc, Growth>::iterator vector<T, Alloc, Growth>::insert(
+    iterator pos, InputIt first, InputIt last) {
+  using category = typename std::iterator_traits<InputIt>::iterator_category;
+  size_type index = pos.base() - vect_;
+  if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+    size_type count = std::distance(first, last);
+    if (count == 0) return iterator(vect_ + index);
+    OpenGap(index, count);
+    size_type built = 0;
+    try {
+      for (; built < count; ++built, ++first) {
+        Construct(vect_ + index + built, *first);
+      }
+    } catch (...) {
+      DestroyElements(vect_ + index, vect_ + index + built);
+      CloseGap(index, count);
+      throw;
     }
-    ++size_;
+    size_ += count;
   } else {
-    cap_ = size_ * 2 + 1;
-    pointer newarr =
-        reinterpret_cast<pointer>(new int8_t[cap_ * sizeof(value_type)]);
-    for (size_type i = 0, j = 0; i < size_; ++i, ++j) {
-      if (pos.ptr_ == vect_ + i) {
-        new (newarr + j) value_type(value);
-        pos.ptr_ = newarr + j;
-        ++j;
-      }
-      new (newarr + j) value_type(vect_[i]);
+    // a single pass range has no length to open a gap for, it is appended
+    // and rotated into place
+    size_type old_size = size_;
+    try {
+      for (; first != last; ++first) emplace_back(*first);
+    } catch (...) {
+      erase(iterator(vect_ + old_size), end());
+      throw;
     }
-    delete[] reinterpret_cast<int8_t *>(vect_);
-    vect_ = newarr;
-    ++size_;
+    std::rotate(vect_ + index, vect_ + old_size, vect_ + size_);
   }
-  return pos;
+  return iterator(vect_ + index);
 }
 
-template <typename T>
-void vector<T>::erase(iterator pos) {
+template <typename T, typename Alloc, typename Growth>
+typename vector<T, Alloc, Growth>::iterator vector<T, Alloc, Growth>::erase(
+    iterator pos) {
   if (pos == end()) {
     throw std::logic_error(
         "The end() iterator cannot be used as a value for pos\n");
   }
-  vector<value_type> temp(*this);
-  size_type erase = pos.ptr_ - vect_;
-  for (size_type i = erase, j = erase + 1; j < temp.size_;) {
-    vect_[i++] = temp[j++];
+  return erase(pos, iterator(pos.base() + 1));
+}
+
+template <typename T, typename Alloc, typename Growth>
+typename vector<T, Alloc, Growth>::iterator vector<T, Alloc, Growth>::erase(
+    iterator first, iterator last) {
+  size_type count = last.base() - first.base();
+  if (count == 0) return first;
+  pointer tail = last.base();
+  size_type tail_size = (vect_ + size_) - tail;
+  if constexpr (is_trivially_relocatable<value_type>::value) {
+    DestroyElements(first.base(), last.base());
+    std::memmove(static_cast<void *>(first.base()),
+                 static_cast<const void *>(tail),
+                 tail_size * sizeof(value_type));
+  } else {
+    std::move(tail, tail + tail_size, first.base());
+    DestroyElements(vect_ + size_ - count, vect_ + size_);
   }
-  --size_;
+  size_ -= count;
+  return first;
 }
 
-template <typename T>
-void vector<T>::push_back(const_reference element) {
-  if (size_ == cap_) {
-    reserve(size_ + 5);
-  }
-  new (vect_ + size_) value_type(element);
-  ++size_;
+template <typename T, typename Alloc, typename Growth>
+void vector<T, Alloc, Growth>::push_back(const_reference element) {
+  emplace_back(element);
 }
 
-template <typename T>
-void vector<T>::pop_back() {
+template <typename T, typename Alloc, typename Growth>
+void vector<T, Alloc, Growth>::push_back(value_type &&element) {
+  emplace_back(std::move(element));
+}
+
+template <typename T, typename Alloc, typename Growth>
+void vector<T, Alloc, Growth>::pop_back() {
   if (size_ > 0) {
     --size_;
-    (vect_ + size_)->~value_type();
+    DestroyElements(vect_ + size_, vect_ + size_ + 1);
   }
 }
 
-template <typename T>
-void vector<T>::swap(vector &other) {
+template <typename T, typename Alloc, typename Growth>
+void vector<T, Alloc, Growth>::swap(vector &other) {
   CopySwapWithStd(*this, other);
 }
 
-template <typename T>
+template <typename T, typename Alloc, typename Growth>
 template <typename... Args>
-typename vector<T>::iterator vector<T>::emplace(const_iterator pos,
-                                                Args &&...args) {
-  iterator result(const_cast<value_type *>(pos.ptr_));
-  for (auto value : {std::forward<Args>(args)...}) {
-    result = insert(result, value);
-    ++result;
+typename vector<T, Alloc, Growth>::iterator vector<T, Alloc, Growth>::emplace(
+    const_iterator pos, Args &&...args) {
+  size_type index = pos.base() - vect_;
+  if (index == size_) {
+    emplace_back(std::forward<Args>(args)...);
+  } else if (size_ == cap_) {
+    ReallocInsert(index, std::forward<Args>(args)...);
+  } else {
+    // args may refer to an element that the shift is about to move, so the
+    // new value is built before the tail is touched
+    value_type temp(std::forward<Args>(args)...);
+    OpenGap(index, 1);
+    try {
+      Construct(vect_ + index, std::move(temp));
+    } catch (...) {
+      CloseGap(index, 1);
+      throw;
+    }
+    ++size_;
   }
-  return --result;
+  return iterator(vect_ + index);
 }
 
-template <typename T>
+template <typename T, typename Alloc, typename Growth>
 template <typename... Args>
-void vector<T>::emplace_back(Args &&...args) {
-  for (auto value : {std::forward<Args>(args)...}) {
-    push_back(value);
+typename vector<T, Alloc, Growth>::reference
+vector<T, Alloc, Growth>::emplace_back(Args &&...args) {
+  if (size_ == cap_) {
+    ReallocInsert(size_, std::forward<Args>(args)...);
+  } else {
+    Construct(vect_ + size_, std::forward<Args>(args)...);
+    ++size_;
   }
+  return back();
 }
 
-template <typename T>
-void vector<T>::CopySwapWithStd(vector &one, vector &two) noexcept {
+template <typename T, typename Alloc, typename Growth>
+void vector<T, Alloc, Growth>::CopySwapWithStd(vector &one,
+                                               vector &two) noexcept {
+  if constexpr (alloc_traits::propagate_on_container_swap::value) {
+    std::swap(one.alloc_, two.alloc_);
+  }
   std::swap(one.size_, two.size_);
   std::swap(one.cap_, two.cap_);
   std::swap(one.vect_, two.vect_);
+  std::swap(one.realloc_count_, two.realloc_count_);
+}
+
+// StealStorage() takes over the buffer of other, the current one must be
+// already released
+template <typename T, typename Alloc, typename Growth>
+void vector<T, Alloc, Growth>::StealStorage(vector &other) noexcept {
+  vect_ = other.vect_;
+  size_ = other.size_;
+  cap_ = other.cap_;
+  realloc_count_ = other.realloc_count_;
+  other.vect_ = nullptr;
+  other.size_ = other.cap_ = other.realloc_count_ = 0;
+}
+
+template <typename T, typename Alloc, typename Growth>
+void vector<T, Alloc, Growth>::FreeStorage() noexcept {
+  clear();
+  if (vect_) alloc_traits::deallocate(alloc_, vect_, cap_);
+  vect_ = nullptr;
+  cap_ = 0;
+}
+
+template <typename T, typename Alloc, typename Growth>
+typename vector<T, Alloc, Growth>::pointer vector<T, Alloc, Growth>::Allocate(
+    size_type n) {
+  return n == 0 ? nullptr : alloc_traits::allocate(alloc_, n);
+}
+
+// ReplaceStorage() releases the current buffer, whose elements have already
+// been relocated, and adopts newarr. The first allocation of an empty vector
+// is not counted as a reallocation
+template <typename T, typename Alloc, typename Growth>
+void vector<T, Alloc, Growth>::ReplaceStorage(pointer newarr,
+                                              size_type new_cap) {
+  if (vect_) {
+    alloc_traits::deallocate(alloc_, vect_, cap_);
+    ++realloc_count_;
+  }
+  vect_ = newarr;
+  cap_ = new_cap;
+}
+
+template <typename T, typename Alloc, typename Growth>
+template <typename... Args>
+void vector<T, Alloc, Growth>::Construct(pointer where, Args &&...args) {
+  alloc_traits::construct(alloc_, where, std::forward<Args>(args)...);
+}
+
+template <typename T, typename Alloc, typename Growth>
+void vector<T, Alloc, Growth>::DestroyElements(pointer first,
+                                               pointer last) noexcept {
+  for (; first != last; ++first) alloc_traits::destroy(alloc_, first);
+}
+
+template <typename T, typename Alloc, typename Growth>
+typename vector<T, Alloc, Growth>::size_type
+vector<T, Alloc, Growth>::GrowCapacity(size_type required) const {
+  if (required > max_size())
+    throw std::length_error("Cannot grow vector larger than max_size()");
+  size_type result = growth_policy::NextCapacity(cap_, required);
+  return result > max_size() || result < cap_ ? max_size() : result;
+}
+
+// RelocateElements() moves count elements to the raw storage at to, or copies
+// them with kRelocateByCopy, so they survive a failed reallocation. Unless
+// they are trivially relocatable the old elements are left for the caller to
+// destroy, and if building one throws the new ones are destroyed
+template <typename T, typename Alloc, typename Growth>
+void vector<T, Alloc, Growth>::RelocateElements(pointer from, size_type count,
+                                                pointer to) {
+  if (count == 0) return;
+  if constexpr (is_trivially_relocatable<value_type>::value) {
+    std::memcpy(static_cast<void *>(to), static_cast<const void *>(from),
+                count * sizeof(value_type));
+  } else {
+    size_type i = 0;
+    try {
+      for (; i < count; ++i) {
+        if constexpr (kRelocateByCopy) {
+          Construct(to + i, from[i]);
+        } else {
+          Construct(to + i, std::move(from[i]));
+        }
+      }
+    } catch (...) {
+      DestroyElements(to, to + i);
+      throw;
+    }
+  }
 }
 
+// RelocateAround() relocates the elements to newarr, leaving count slots at
+// index for the caller, and destroys the old ones once all are relocated. If
+// building an element throws, newarr is left without elements and the vector
+// keeps its own, moved-from ones included
+template <typename T, typename Alloc, typename Growth>
+void vector<T, Alloc, Growth>::RelocateAround(pointer newarr, size_type index,
+                                              size_type count) {
+  RelocateElements(vect_, index, newarr);
+  try {
+    RelocateElements(vect_ + index, size_ - index, newarr + index + count);
+  } catch (...) {
+    DestroyElements(newarr, newarr + index);
+    throw;
+  }
+  if constexpr (!is_trivially_relocatable<value_type>::value) {
+    DestroyElements(vect_, vect_ + size_);
+  }
+}
+
+// Reallocate() moves the elements to a new storage of new_cap slots with
+// count uninitialized slots at index. If relocating an element throws, the new
+// storage is freed and the vector is left as it was
+template <typename T, typename Alloc, typename Growth>
+void vector<T, Alloc, Growth>::Reallocate(size_type new_cap, size_type index,
+                                          size_type count) {
+  pointer newarr = Allocate(new_cap);
+  try {
+    RelocateAround(newarr, index, count);
+  } catch (...) {
+    alloc_traits::deallocate(alloc_, newarr, new_cap);
+    throw;
+  }
+  ReplaceStorage(newarr, new_cap);
+}
+
+// OpenGap() leaves count uninitialized slots at index, shifting the tail in
+// place when the capacity allows it and reallocating otherwise. size_ is not
+// changed, the caller constructs the new elements and updates it
+template <typename T, typename Alloc, typename Growth>
+void vector<T, Alloc, Growth>::OpenGap(size_type index, size_type count) {
+  size_type tail_size = size_ - index;
+  if (size_ + count > cap_) {
+    Reallocate(GrowCapacity(size_ + count), index, count);
+  } else if constexpr (is_trivially_relocatable<value_type>::value) {
+    std::memmove(static_cast<void *>(vect_ + index + count),
+                 static_cast<const void *>(vect_ + index),
+                 tail_size * sizeof(value_type));
+  } else if (tail_size > 0) {
+    pointer last = vect_ + size_;
+    size_type raw = tail_size < count ? tail_size : count;
+    // the last elements move to raw storage past the end, the rest of the
+    // tail is move-assigned backwards and the moved-from gap is destroyed
+    for (size_type i = raw; i > 0; --i) {
+      Construct(last + count - i, std::move(*(last - i)));
+    }
+    std::move_backward(vect_ + index, last - raw, last);
+    DestroyElements(vect_ + index, vect_ + index + raw);
+  }
+}
+
+// CloseGap() undoes OpenGap(index, count) once the slots of the gap hold no
+// elements again, moving the tail back down
+template <typename T, typename Alloc, typename Growth>
+void vector<T, Alloc, Growth>::CloseGap(size_type index, size_type count) {
+  pointer tail = vect_ + index + count;
+  size_type tail_size = size_ - index;
+  if constexpr (is_trivially_relocatable<value_type>::value) {
+    std::memmove(static_cast<void *>(vect_ + index),
+                 static_cast<const void *>(tail),
+                 tail_size * sizeof(value_type));
+  } else {
+    for (size_type i = 0; i < tail_size; ++i) {
+      if (i < count) {
+        Construct(vect_ + index + i, std::move(tail[i]));
+      } else {
+        vect_[index + i] = std::move(tail[i]);
+      }
+    }
+    size_type moved_out = tail_size < count ? tail_size : count;
+    DestroyElements(vect_ + size_ + count - moved_out, vect_ + size_ + count);
+  }
+}
+
+// ReallocInsert() builds the new element directly in a grown storage before
+// the old elements are relocated, so args may safely refer to them. If the
+// relocation throws, the new element and storage are released
+template <typename T, typename Alloc, typename Growth>
+template <typename... Args>
+void vector<T, Alloc, Growth>::ReallocInsert(size_type index, Args &&...args) {
+  size_type new_cap = GrowCapacity(size_ + 1);
+  pointer newarr = Allocate(new_cap);
+  bool built = false;
+  try {
+    Construct(newarr + index, std::forward<Args>(args)...);
+    built = true;
+    RelocateAround(newarr, index, 1);
+  } catch (...) {
+    if (built) DestroyElements(newarr + index, newarr + index + 1);
+    alloc_traits::deallocate(alloc_, newarr, new_cap);
+    throw;
+  }
+  ReplaceStorage(newarr, new_cap);
+  ++size_;
+}
+
+namespace pmr {
+// s21::pmr::vector draws its storage from a std::pmr::memory_resource, e.g.
+// a monotonic_buffer_resource that is released in bulk
+template <typename T, typename Growth = GeometricGrowth<>>
+using vector = s21::vector<T, std::pmr::polymorphic_allocator<T>, Growth>;
+}  // namespace pmr
+
 }  // namespace s21
 
+#include "s21_vector_bool.h"
+
 #endif  // SRC_S21_VECTOR_H_
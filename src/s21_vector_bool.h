@@ -0,0 +1,724 @@
+#ifndef SRC_S21_VECTOR_BOOL_H_
+#define SRC_S21_VECTOR_BOOL_H_
+
+// vector<bool> specialization, included at the end of s21_vector.h so that
+// it is always visible together with the primary template
+
+namespace s21 {
+// BitReference is the proxy vector<bool> hands out instead of bool &
+class BitReference {
+ public:
+  using word_type = std::uint64_t;
+
+  BitReference(word_type *word, word_type mask);
+  BitReference(const BitReference &other) = default;
+  BitReference &operator=(bool value);
+  BitReference &operator=(const BitReference &other);
+  operator bool() const;
+  bool operator~() const;
+  // flip() inverts the referenced bit
+  void flip();
+
+ private:
+  word_type *word_;
+  word_type mask_;
+};
+
+inline BitReference::BitReference(word_type *word, word_type mask)
+    : word_(word), mask_(mask) {}
+
+inline BitReference &BitReference::operator=(bool value) {
+  if (value) {
+    *word_ |= mask_;
+  } else {
+    *word_ &= ~mask_;
+  }
+  return *this;
+}
+
+inline BitReference &BitReference::operator=(const BitReference &other) {
+  return *this = static_cast<bool>(other);
+}
+
+inline BitReference::operator bool() const { return (*word_ & mask_) != 0; }
+
+inline bool BitReference::operator~() const { return !static_cast<bool>(*this); }
+
+inline void BitReference::flip() { *word_ ^= mask_; }
+
+// swap() exchanges the referenced bits, the proxies stay where they are
+inline void swap(BitReference one, BitReference two) {
+  bool temp = one;
+  one = two;
+  two = temp;
+}
+
+// BitIterator is the random access iterator of vector<bool>: a pointer to
+// the words and a bit position
+template <bool IsConst>
+class BitIterator {
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = bool;
+  using difference_type = std::ptrdiff_t;
+  using pointer = void;
+  using reference = std::conditional_t<IsConst, bool, BitReference>;
+  using word_pointer = std::conditional_t<IsConst, const std::uint64_t *,
+                                          std::uint64_t *>;
+
+  BitIterator();
+  BitIterator(word_pointer words, std::size_t pos);
+  // An iterator converts to a const iterator
+  template <bool OtherConst,
+            typename = std::enable_if_t<IsConst && !OtherConst>>
+  BitIterator(const BitIterator<OtherConst> &other);
+
+  reference operator*() const;
+  reference operator[](difference_type n) const;
+
+  BitIterator &operator++();
+  BitIterator operator++(int);
+  BitIterator &operator--();
+  BitIterator operator--(int);
+  BitIterator &operator+=(difference_type n);
+  BitIterator &operator-=(difference_type n);
+  BitIterator operator+(difference_type n) const;
+  BitIterator operator-(difference_type n) const;
+
+  // words() and pos() return the word array and the bit position
+  word_pointer words() const;
+  std::size_t pos() const;
+
+ private:
+  word_pointer words_;
+  std::size_t pos_;
+};
+
+template <bool IsConst>
+BitIterator<IsConst>::BitIterator() : words_(nullptr), pos_(0) {}
+
+template <bool IsConst>
+BitIterator<IsConst>::BitIterator(word_pointer words, std::size_t pos)
+    : words_(words), pos_(pos) {}
+
+template <bool IsConst>
+template <bool OtherConst, typename>
+BitIterator<IsConst>::BitIterator(const BitIterator<OtherConst> &other)
+    : words_(other.words()), pos_(other.pos()) {}
+
+template <bool IsConst>
+typename BitIterator<IsConst>::reference BitIterator<IsConst>::operator*()
+    const {
+  auto mask = std::uint64_t(1) << (pos_ % 64);
+  if constexpr (IsConst) {
+    return (words_[pos_ / 64] & mask) != 0;
+  } else {
+    return BitReference(words_ + pos_ / 64, mask);
+  }
+}
+
+template <bool IsConst>
+typename BitIterator<IsConst>::reference BitIterator<IsConst>::operator[](
+    difference_type n) const {
+  return *(*this + n);
+}
+
+template <bool IsConst>
+BitIterator<IsConst> &BitIterator<IsConst>::operator++() {
+  ++pos_;
+  return *this;
+}
+
+template <bool IsConst>
+BitIterator<IsConst> BitIterator<IsConst>::operator++(int) {
+  BitIterator temp = *this;
+  ++pos_;
+  return temp;
+}
+
+template <bool IsConst>
+BitIterator<IsConst> &BitIterator<IsConst>::operator--() {
+  --pos_;
+  return *this;
+}
+
+template <bool IsConst>
+BitIterator<IsConst> BitIterator<IsConst>::operator--(int) {
+  BitIterator temp = *this;
+  --pos_;
+  return temp;
+}
+
+template <bool IsConst>
+BitIterator<IsConst> &BitIterator<IsConst>::operator+=(difference_type n) {
+  pos_ += n;
+  return *this;
+}
+
+template <bool IsConst>
+BitIterator<IsConst> &BitIterator<IsConst>::operator-=(difference_type n) {
+  pos_ -= n;
+  return *this;
+}
+
+template <bool IsConst>
+BitIterator<IsConst> BitIterator<IsConst>::operator+(
+    difference_type n) const {
+  return BitIterator(words_, pos_ + n);
+}
+
+template <bool IsConst>
+BitIterator<IsConst> BitIterator<IsConst>::operator-(
+    difference_type n) const {
+  return BitIterator(words_, pos_ - n);
+}
+
+template <bool IsConst>
+typename BitIterator<IsConst>::word_pointer BitIterator<IsConst>::words()
+    const {
+  return words_;
+}
+
+template <bool IsConst>
+std::size_t BitIterator<IsConst>::pos() const {
+  return pos_;
+}
+
+template <bool IsConst>
+BitIterator<IsConst> operator+(std::ptrdiff_t n,
+                               const BitIterator<IsConst> &it) {
+  return it + n;
+}
+
+template <bool One, bool Two>
+std::ptrdiff_t operator-(const BitIterator<One> &one,
+                         const BitIterator<Two> &two) {
+  return static_cast<std::ptrdiff_t>(one.pos() - two.pos());
+}
+
+template <bool One, bool Two>
+bool operator==(const BitIterator<One> &one, const BitIterator<Two> &two) {
+  return one.words() == two.words() && one.pos() == two.pos();
+}
+
+template <bool One, bool Two>
+bool operator!=(const BitIterator<One> &one, const BitIterator<Two> &two) {
+  return !(one == two);
+}
+
+template <bool One, bool Two>
+bool operator<(const BitIterator<One> &one, const BitIterator<Two> &two) {
+  return one.pos() < two.pos();
+}
+
+template <bool One, bool Two>
+bool operator>(const BitIterator<One> &one, const BitIterator<Two> &two) {
+  return one.pos() > two.pos();
+}
+
+template <bool One, bool Two>
+bool operator<=(const BitIterator<One> &one, const BitIterator<Two> &two) {
+  return one.pos() <= two.pos();
+}
+
+template <bool One, bool Two>
+bool operator>=(const BitIterator<One> &one, const BitIterator<Two> &two) {
+  return one.pos() >= two.pos();
+}
+
+// vector<bool> packs the flags into 64-bit words, 8 times less memory than a
+// byte per flag, and scans them a word at a time. The words live in a
+// vector<uint64_t> with the rebound allocator and the same growth policy.
+// Bits past size() in the last word are always zero
+template <typename Alloc, typename Growth>
+class vector<bool, Alloc, Growth> {
+ public:
+  using Iterator = BitIterator<false>;
+  using ConstIterator = BitIterator<true>;
+
+  // Vector Member type
+  using value_type = bool;
+  using allocator_type = Alloc;
+  using reference = BitReference;
+  using const_reference = bool;
+  using iterator = Iterator;
+  using const_iterator = ConstIterator;
+  using size_type = size_t;
+  using growth_policy = Growth;
+  using word_type = std::uint64_t;
+
+  // npos is returned by find_first() and find_next() when no bit is set
+  static constexpr size_type npos = static_cast<size_type>(-1);
+
+  // Vector Member functions
+  vector();
+  explicit vector(const allocator_type &alloc);
+  explicit vector(size_type num,
+                  const allocator_type &alloc = allocator_type());
+  vector(size_type num, bool value,
+         const allocator_type &alloc = allocator_type());
+  vector(std::initializer_list<value_type> const &items,
+         const allocator_type &alloc = allocator_type());
+  vector(const vector &other) = default;
+  vector(const vector &other, const allocator_type &alloc);
+  vector(vector &&other) noexcept;
+  ~vector() = default;
+  vector &operator=(const vector &other) = default;
+  vector &operator=(vector &&other);
+  // get_allocator() returns the allocator associated with the container
+  allocator_type get_allocator() const;
+
+  // Vector Element access
+  // at() access specified element with bounds checking
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  // operator[] access specified element
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  // front() access the first element
+  reference front();
+  const_reference front() const;
+  // back() access the last element
+  reference back();
+  const_reference back() const;
+  // words() direct access to the packed words, bit i is bit i % 64 of word
+  // i / 64
+  const word_type *words() const;
+
+  // Vector Iterators
+  // begin() returns an iterator to the beginning
+  iterator begin();
+  const_iterator begin() const;
+  // end() returns an iterator to the end
+  iterator end();
+  const_iterator end() const;
+
+  // Vector Capacity
+  // empty() checks whether the container is empty
+  bool empty() const;
+  // size() returns the number of elements
+  size_type size() const;
+  // max_size() returns the maximum possible number of elements
+  size_type max_size() const;
+  // reserve() allocates storage for at least n bits
+  void reserve(size_type n);
+  // capacity() returns the number of bits that fit into the allocated words
+  size_type capacity() const;
+  // shrink_to_fit() reduces memory usage by freeing unused words
+  void shrink_to_fit();
+  // reallocations() returns how many times the storage has been reallocated
+  size_type reallocations() const;
+
+  // Vector Modifiers
+  // clear() clears the contents
+  void clear();
+  // insert() inserts value before pos and returns an iterator to it
+  iterator insert(iterator pos, bool value);
+  // erase() erases the bit at pos (or the range [first, last)) and returns
+  // the iterator following the last removed bit
+  iterator erase(iterator pos);
+  iterator erase(iterator first, iterator last);
+  // push_back() adds a bit to the end
+  void push_back(bool value);
+  // pop_back() removes the last bit
+  void pop_back();
+  // swap() swaps the contents
+  void swap(vector &other);
+  // flip() inverts every bit
+  void flip();
+
+  // Vector Bit operations
+  // count() returns the number of set bits
+  size_type count() const;
+  // find_first() returns the index of the first set bit or npos
+  size_type find_first() const;
+  // find_next() returns the index of the first set bit after pos or npos
+  size_type find_next(size_type pos) const;
+  // operator&=, operator|= and operator^= combine the bits word by word with
+  // those of a vector of the same size
+  vector &operator&=(const vector &other);
+  vector &operator|=(const vector &other);
+  vector &operator^=(const vector &other);
+
+ private:
+  using word_allocator = typename std::allocator_traits<
+      Alloc>::template rebind_alloc<word_type>;
+  static constexpr size_type kWordBits = 64;
+
+  vector<word_type, word_allocator, Growth> words_;
+  size_type size_ = 0;
+
+  // Vector Helper Methods
+  static size_type WordsFor(size_type bits);
+  static word_type LowMask(size_type bits);
+  void ClearTail();
+  size_type FindFrom(size_type index) const;
+  void CheckSameSize(const vector &other) const;
+};
+
+// Vector<bool> class implementation
+
+template <typename Alloc, typename Growth>
+vector<bool, Alloc, Growth>::vector() : vector(allocator_type()) {}
+
+template <typename Alloc, typename Growth>
+vector<bool, Alloc, Growth>::vector(const allocator_type &alloc)
+    : words_(word_allocator(alloc)) {}
+
+template <typename Alloc, typename Growth>
+vector<bool, Alloc, Growth>::vector(size_type num, const allocator_type &alloc)
+    : vector(num, false, alloc) {}
+
+template <typename Alloc, typename Growth>
+vector<bool, Alloc, Growth>::vector(size_type num, bool value,
+                                    const allocator_type &alloc)
+    : words_(WordsFor(num), word_allocator(alloc)), size_(num) {
+  if (value) flip();
+}
+
+template <typename Alloc, typename Growth>
+vector<bool, Alloc, Growth>::vector(
+    std::initializer_list<value_type> const &items,
+    const allocator_type &alloc)
+    : words_(WordsFor(items.size()), word_allocator(alloc)),
+      size_(items.size()) {
+  size_type i = 0;
+  for (bool item : items) (*this)[i++] = item;
+}
+
+template <typename Alloc, typename Growth>
+vector<bool, Alloc, Growth>::vector(const vector &other,
+                                    const allocator_type &alloc)
+    : words_(other.words_, word_allocator(alloc)), size_(other.size_) {}
+
+template <typename Alloc, typename Growth>
+vector<bool, Alloc, Growth>::vector(vector &&other) noexcept
+    : words_(std::move(other.words_)), size_(other.size_) {
+  other.size_ = 0;
+}
+
+template <typename Alloc, typename Growth>
+vector<bool, Alloc, Growth> &vector<bool, Alloc, Growth>::operator=(
+    vector &&other) {
+  if (this != &other) {
+    words_ = std::move(other.words_);
+    size_ = other.size_;
+    other.words_.clear();
+    other.size_ = 0;
+  }
+  return *this;
+}
+
+template <typename Alloc, typename Growth>
+typename vector<bool, Alloc, Growth>::allocator_type
+vector<bool, Alloc, Growth>::get_allocator() const {
+  return allocator_type(words_.get_allocator());
+}
+
+template <typename Alloc, typename Growth>
+typename vector<bool, Alloc, Growth>::reference
+vector<bool, Alloc, Growth>::at(size_type pos) {
+  if (pos >= size_) {
+    throw std::out_of_range("Position is out_of_range\n");
+  }
+  return (*this)[pos];
+}
+
+template <typename Alloc, typename Growth>
+typename vector<bool, Alloc, Growth>::const_reference
+vector<bool, Alloc, Growth>::at(size_type pos) const {
+  if (pos >= size_) {
+    throw std::out_of_range("Position is out_of_range\n");
+  }
+  return (*this)[pos];
+}
+
+template <typename Alloc, typename Growth>
+typename vector<bool, Alloc, Growth>::reference
+vector<bool, Alloc, Growth>::operator[](size_type pos) {
+  return begin()[pos];
+}
+
+template <typename Alloc, typename Growth>
+typename vector<bool, Alloc, Growth>::const_reference
+vector<bool, Alloc, Growth>::operator[](size_type pos) const {
+  return begin()[pos];
+}
+
+template <typename Alloc, typename Growth>
+typename vector<bool, Alloc, Growth>::reference
+vector<bool, Alloc, Growth>::front() {
+  return (*this)[0];
+}
+
+template <typename Alloc, typename Growth>
+typename vector<bool, Alloc, Growth>::const_reference
+vector<bool, Alloc, Growth>::front() const {
+  return (*this)[0];
+}
+
+template <typename Alloc, typename Growth>
+typename vector<bool, Alloc, Growth>::reference
+vector<bool, Alloc, Growth>::back() {
+  return (*this)[size_ - 1];
+}
+
+template <typename Alloc, typename Growth>
+typename vector<bool, Alloc, Growth>::const_reference
+vector<bool, Alloc, Growth>::back() const {
+  return (*this)[size_ - 1];
+}
+
+template <typename Alloc, typename Growth>
+const typename vector<bool, Alloc, Growth>::word_type *
+vector<bool, Alloc, Growth>::words() const {
+  return words_.data();
+}
+
+template <typename Alloc, typename Growth>
+typename vector<bool, Alloc, Growth>::iterator
+vector<bool, Alloc, Growth>::begin() {
+  return iterator(words_.data(), 0);
+}
+
+template <typename Alloc, typename Growth>
+typename vector<bool, Alloc, Growth>::const_iterator
+vector<bool, Alloc, Growth>::begin() const {
+  return const_iterator(words_.data(), 0);
+}
+
+template <typename Alloc, typename Growth>
+typename vector<bool, Alloc, Growth>::iterator
+vector<bool, Alloc, Growth>::end() {
+  return iterator(words_.data(), size_);
+}
+
+template <typename Alloc, typename Growth>
+typename vector<bool, Alloc, Growth>::const_iterator
+vector<bool, Alloc, Growth>::end() const {
+  return const_iterator(words_.data(), size_);
+}
+
+template <typename Alloc, typename Growth>
+bool vector<bool, Alloc, Growth>::empty() const {
+  return size_ == 0;
+}
+
+template <typename Alloc, typename Growth>
+typename vector<bool, Alloc, Growth>::size_type
+vector<bool, Alloc, Growth>::size() const {
+  return size_;
+}
+
+template <typename Alloc, typename Growth>
+typename vector<bool, Alloc, Growth>::size_type
+vector<bool, Alloc, Growth>::max_size() const {
+  size_type words = words_.max_size();
+  return words > npos / kWordBits ? npos : words * kWordBits;
+}
+
+template <typename Alloc, typename Growth>
+void vector<bool, Alloc, Growth>::reserve(size_type n) {
+  if (n > max_size()) {
+    throw std::length_error("Cannot reserve more than max_size()");
+  }
+  words_.reserve(WordsFor(n));
+}
+
+template <typename Alloc, typename Growth>
+typename vector<bool, Alloc, Growth>::size_type
+vector<bool, Alloc, Growth>::capacity() const {
+  return words_.capacity() * kWordBits;
+}
+
+template <typename Alloc, typename Growth>
+void vector<bool, Alloc, Growth>::shrink_to_fit() {
+  words_.shrink_to_fit();
+}
+
+template <typename Alloc, typename Growth>
+typename vector<bool, Alloc, Growth>::size_type
+vector<bool, Alloc, Growth>::reallocations() const {
+  return words_.reallocations();
+}
+
+template <typename Alloc, typename Growth>
+void vector<bool, Alloc, Growth>::clear() {
+  words_.clear();
+  size_ = 0;
+}
+
+// insert() shifts the bits from pos on up by one a word at a time
+template <typename Alloc, typename Growth>
+typename vector<bool, Alloc, Growth>::iterator
+vector<bool, Alloc, Growth>::insert(iterator pos, bool value) {
+  size_type index = pos.pos();
+  push_back(false);
+  word_type *words = words_.data();
+  size_type first = index / kWordBits;
+  word_type low = LowMask(index % kWordBits);
+  word_type carry = words[first] >> (kWordBits - 1);
+  words[first] = (words[first] & low) | ((words[first] << 1) & ~low);
+  for (size_type i = first + 1; i < words_.size(); ++i) {
+    word_type next_carry = words[i] >> (kWordBits - 1);
+    words[i] = (words[i] << 1) | carry;
+    carry = next_carry;
+  }
+  (*this)[index] = value;
+  return begin() + index;
+}
+
+template <typename Alloc, typename Growth>
+typename vector<bool, Alloc, Growth>::iterator
+vector<bool, Alloc, Growth>::erase(iterator pos) {
+  if (pos == end()) {
+    throw std::logic_error(
+        "The end() iterator cannot be used as a value for pos\n");
+  }
+  size_type index = pos.pos();
+  word_type *words = words_.data();
+  size_type first = index / kWordBits;
+  size_type count = words_.size();
+  word_type low = LowMask(index % kWordBits);
+  words[first] = (words[first] & low) | ((words[first] >> 1) & ~low);
+  for (size_type i = first; i + 1 < count; ++i) {
+    words[i] |= words[i + 1] << (kWordBits - 1);
+    words[i + 1] >>= 1;
+  }
+  --size_;
+  if (size_ % kWordBits == 0) words_.pop_back();
+  return begin() + index;
+}
+
+template <typename Alloc, typename Growth>
+typename vector<bool, Alloc, Growth>::iterator
+vector<bool, Alloc, Growth>::erase(iterator first, iterator last) {
+  size_type to = first.pos();
+  for (size_type from = last.pos(); from < size_; ++from, ++to) {
+    (*this)[to] = (*this)[from];
+  }
+  size_ = to;
+  size_type words = WordsFor(size_);
+  while (words_.size() > words) words_.pop_back();
+  ClearTail();
+  return begin() + first.pos();
+}
+
+template <typename Alloc, typename Growth>
+void vector<bool, Alloc, Growth>::push_back(bool value) {
+  if (size_ % kWordBits == 0) words_.push_back(0);
+  ++size_;
+  back() = value;
+}
+
+template <typename Alloc, typename Growth>
+void vector<bool, Alloc, Growth>::pop_back() {
+  if (size_ == 0) return;
+  back() = false;
+  --size_;
+  if (size_ % kWordBits == 0) words_.pop_back();
+}
+
+template <typename Alloc, typename Growth>
+void vector<bool, Alloc, Growth>::swap(vector &other) {
+  words_.swap(other.words_);
+  std::swap(size_, other.size_);
+}
+
+template <typename Alloc, typename Growth>
+void vector<bool, Alloc, Growth>::flip() {
+  for (word_type &word : words_) word = ~word;
+  ClearTail();
+}
+
+template <typename Alloc, typename Growth>
+typename vector<bool, Alloc, Growth>::size_type
+vector<bool, Alloc, Growth>::count() const {
+  size_type result = 0;
+  for (word_type word : words_) result += __builtin_popcountll(word);
+  return result;
+}
+
+template <typename Alloc, typename Growth>
+typename vector<bool, Alloc, Growth>::size_type
+vector<bool, Alloc, Growth>::find_first() const {
+  return FindFrom(0);
+}
+
+template <typename Alloc, typename Growth>
+typename vector<bool, Alloc, Growth>::size_type
+vector<bool, Alloc, Growth>::find_next(size_type pos) const {
+  return pos == npos ? npos : FindFrom(pos + 1);
+}
+
+template <typename Alloc, typename Growth>
+vector<bool, Alloc, Growth> &vector<bool, Alloc, Growth>::operator&=(
+    const vector &other) {
+  CheckSameSize(other);
+  const word_type *from = other.words_.data();
+  for (word_type &word : words_) word &= *from++;
+  return *this;
+}
+
+template <typename Alloc, typename Growth>
+vector<bool, Alloc, Growth> &vector<bool, Alloc, Growth>::operator|=(
+    const vector &other) {
+  CheckSameSize(other);
+  const word_type *from = other.words_.data();
+  for (word_type &word : words_) word |= *from++;
+  return *this;
+}
+
+template <typename Alloc, typename Growth>
+vector<bool, Alloc, Growth> &vector<bool, Alloc, Growth>::operator^=(
+    const vector &other) {
+  CheckSameSize(other);
+  const word_type *from = other.words_.data();
+  for (word_type &word : words_) word ^= *from++;
+  return *this;
+}
+
+// Vector<bool> Helper Methods
+
+template <typename Alloc, typename Growth>
+typename vector<bool, Alloc, Growth>::size_type
+vector<bool, Alloc, Growth>::WordsFor(size_type bits) {
+  return bits / kWordBits + (bits % kWordBits != 0);
+}
+
+// LowMask() returns a word with the lowest bits bits set, bits < 64
+template <typename Alloc, typename Growth>
+typename vector<bool, Alloc, Growth>::word_type
+vector<bool, Alloc, Growth>::LowMask(size_type bits) {
+  return (word_type(1) << bits) - 1;
+}
+
+// ClearTail() zeroes the bits of the last word that are past size()
+template <typename Alloc, typename Growth>
+void vector<bool, Alloc, Growth>::ClearTail() {
+  if (size_ % kWordBits) words_.back() &= LowMask(size_ % kWordBits);
+}
+
+template <typename Alloc, typename Growth>
+typename vector<bool, Alloc, Growth>::size_type
+vector<bool, Alloc, Growth>::FindFrom(size_type index) const {
+  if (index >= size_) return npos;
+  size_type word = index / kWordBits;
+  word_type bits = words_[word] & (~word_type(0) << (index % kWordBits));
+  while (bits == 0) {
+    if (++word == words_.size()) return npos;
+    bits = words_[word];
+  }
+  return word * kWordBits + __builtin_ctzll(bits);
+}
+
+template <typename Alloc, typename Growth>
+void vector<bool, Alloc, Growth>::CheckSameSize(const vector &other) const {
+  if (size_ != other.size_) {
+    throw std::invalid_argument(
+        "Bitwise operations need vectors of the same size");
+  }
+}
+}  // namespace s21
+
+#endif  // SRC_S21_VECTOR_BOOL_H_
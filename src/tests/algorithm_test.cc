@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+
+namespace {
+std::vector<s21::simd::Isa> SupportedIsas() {
+  std::vector<s21::simd::Isa> result{s21::simd::Isa::kScalar};
+  if (s21::simd::BestIsa() != s21::simd::Isa::kScalar) {
+    result.push_back(s21::simd::Isa::kSse2);
+  }
+  if (s21::simd::BestIsa() == s21::simd::Isa::kAvx2) {
+    result.push_back(s21::simd::Isa::kAvx2);
+  }
+  return result;
+}
+
+template <typename T>
+std::vector<T> Pseudorandom(size_t size, int range) {
+  std::vector<T> result;
+  unsigned seed = 42;
+  for (size_t i = 0; i < size; ++i) {
+    seed = seed * 1103515245u + 12345u;
+    result.push_back(static_cast<T>(static_cast<int>(seed >> 8) % range -
+                                    range / 2));
+  }
+  return result;
+}
+}  // namespace
+
+TEST(AlgorithmTest, FindEveryIsa) {
+  for (size_t size : {0, 1, 3, 4, 7, 8, 9, 31, 100}) {
+    auto items = Pseudorandom<int>(size, 50);
+    const int *first = items.data();
+    const int *last = first + size;
+    for (auto isa : SupportedIsas()) {
+      for (int value = -26; value <= 26; ++value) {
+        ASSERT_EQ(s21::simd::Find(first, last, value, isa),
+                  std::find(first, last, value));
+        ASSERT_EQ(s21::simd::Count(first, last, value, isa),
+                  static_cast<size_t>(std::count(first, last, value)));
+      }
+    }
+  }
+}
+
+TEST(AlgorithmTest, FloatFindEveryIsa) {
+  auto items = Pseudorandom<float>(77, 20);
+  items[70] = -0.0f;
+  const float *first = items.data();
+  const float *last = first + items.size();
+  for (auto isa : SupportedIsas()) {
+    for (float value : {-10.0f, 0.0f, 3.0f, 9.0f, 0.5f, NAN}) {
+      ASSERT_EQ(s21::simd::Find(first, last, value, isa),
+                std::find(first, last, value));
+      ASSERT_EQ(s21::simd::Count(first, last, value, isa),
+                static_cast<size_t>(std::count(first, last, value)));
+    }
+  }
+}
+
+TEST(AlgorithmTest, ExtremumEveryIsa) {
+  for (size_t size : {1, 2, 5, 8, 13, 64, 1001}) {
+    auto items = Pseudorandom<int>(size, 1000);
+    const int *first = items.data();
+    const int *last = first + size;
+    for (auto isa : SupportedIsas()) {
+      ASSERT_EQ(s21::simd::Extremum<true>(first, last, isa),
+                std::min_element(first, last));
+      ASSERT_EQ(s21::simd::Extremum<false>(first, last, isa),
+                std::max_element(first, last));
+    }
+  }
+}
+
+TEST(AlgorithmTest, FloatExtremumEveryIsa) {
+  auto items = Pseudorandom<float>(45, 100);
+  items[30] = 1000.0f;
+  items[40] = -1000.0f;
+  items[41] = 1000.0f;
+  const float *first = items.data();
+  const float *last = first + items.size();
+  for (auto isa : SupportedIsas()) {
+    ASSERT_EQ(s21::simd::Extremum<true>(first, last, isa), first + 40);
+    ASSERT_EQ(s21::simd::Extremum<false>(first, last, isa), first + 30);
+  }
+  items[5] = NAN;
+  for (auto isa : SupportedIsas()) {
+    ASSERT_EQ(s21::simd::Extremum<true>(first, last, isa),
+              std::min_element(first, last));
+    ASSERT_EQ(s21::simd::Extremum<false>(first, last, isa),
+              std::max_element(first, last));
+  }
+}
+
+TEST(AlgorithmTest, SumEveryIsa) {
+  std::vector<int> items(1003, 2000000000);
+  items[7] = -5;
+  std::int64_t expected = std::accumulate(items.begin(), items.end(),
+                                          std::int64_t(0));
+  auto floats = Pseudorandom<float>(99, 64);
+  float float_expected = std::accumulate(floats.begin(), floats.end(), 0.0f);
+  for (auto isa : SupportedIsas()) {
+    ASSERT_EQ(s21::simd::Sum(items.data(), items.data() + items.size(), isa),
+              expected);
+    ASSERT_FLOAT_EQ(
+        s21::simd::Sum(floats.data(), floats.data() + floats.size(), isa),
+        float_expected);
+  }
+}
+
+TEST(AlgorithmTest, Vector) {
+  s21::vector<std::int32_t> one{4, 8, -3, 15, 8, 2, -3, 7, 9, 11, 15};
+  ASSERT_EQ(s21::find(one, 8) - one.begin(), 1);
+  ASSERT_EQ(s21::find(one, 100), one.end());
+  ASSERT_EQ(s21::count(one, 8), 2);
+  ASSERT_TRUE(s21::contains(one, 11));
+  ASSERT_FALSE(s21::contains(one, 12));
+  ASSERT_EQ(s21::min_element(one) - one.begin(), 2);
+  ASSERT_EQ(s21::max_element(one) - one.begin(), 3);
+  ASSERT_EQ(s21::sum(one), 73);
+  *s21::find(one, 8) = 0;
+  ASSERT_EQ(one[1], 0);
+  s21::vector<std::int32_t> empty;
+  ASSERT_EQ(s21::min_element(empty), empty.end());
+  ASSERT_EQ(s21::sum(empty), 0);
+}
+
+TEST(AlgorithmTest, ConstContainers) {
+  const s21::vector<float> one{1.5f, -2.0f, 4.0f};
+  ASSERT_EQ(*s21::max_element(one), 4.0f);
+  ASSERT_EQ(s21::sum(one), 3.5f);
+  const s21::array<double, 4> two{1.0, 2.0, 3.0, 2.0};
+  ASSERT_EQ(s21::count(two, 2.0), 2);
+  ASSERT_EQ(s21::find(two, 3.0) - two.begin(), 2);
+  ASSERT_EQ(*s21::min_element(two), 1.0);
+  s21::small_vector<std::int64_t, 4> three{5, -1};
+  ASSERT_EQ(s21::sum(three), 4);
+  ASSERT_TRUE(s21::contains(three, -1));
+}
@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <array>
+#include <numeric>
 
 #include "../s21_containersplus.h"
 
@@ -178,6 +180,27 @@ TEST(ArrayTest, 28) {
   ASSERT_EQ(res, true);
 }
 
+TEST(ArrayTest, 29) {
+  s21::array<int, 5> one{4, 2, 5, 1, 3};
+  std::sort(one.begin(), one.end());
+  for (size_t i = 0; i < one.size(); ++i) ASSERT_EQ(one[i], int(i) + 1);
+  ASSERT_TRUE(std::binary_search(one.begin(), one.end(), 4));
+  auto it = one.begin() + 2;
+  ASSERT_EQ(it[1], 4);
+  ASSERT_EQ(one.end() - it, 3);
+  ASSERT_TRUE(it > one.begin());
+}
+
+TEST(ArrayTest, 30) {
+  const s21::array<int, 3> one{1, 2, 3};
+  s21::array<int, 3> two;
+  std::copy(one.begin(), one.end(), two.begin());
+  s21::array<int, 3>::const_iterator it = two.begin();
+  ASSERT_TRUE(it == two.begin());
+  ASSERT_EQ(*(it + 2), 3);
+  ASSERT_EQ(std::accumulate(one.begin(), one.end(), 0), 6);
+}
+
 // cause leaks on mac
 
 // TEST(ArrayTest, 15) {
@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 
 #include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include "../s21_containers.h"
 
@@ -543,6 +547,271 @@ TEST(map_test, Operator) {
     EXPECT_EQ((*it1), (*it2));
 }
 
+TEST(map_test, LargeSorted) {
+  s21::Map<int, int> m1;
+  std::map<int, int> m2;
+  for (int i = 0; i < 100000; ++i) {
+    m1.insert(i, -i);
+    m2.insert({i, -i});
+  }
+  for (auto it = m1.begin(); it != m1.end();) {
+    auto next = it;
+    ++next;
+    if ((*it).first % 2) m1.erase(it);
+    it = next;
+  }
+  for (int i = 1; i < 100000; i += 2) m2.erase(i);
+  EXPECT_EQ(m1.size(), m2.size());
+  auto it1 = m1.begin();
+  for (auto it2 = m2.begin(); it2 != m2.end(); ++it1, ++it2) {
+    EXPECT_EQ((*it1).first, it2->first);
+    EXPECT_EQ((*it1).second, it2->second);
+  }
+}
+
+TEST(map_test, LargeRandom) {
+  s21::Map<int, int> m1;
+  std::map<int, int> m2;
+  unsigned seed = 42;
+  for (int i = 0; i < 100000; ++i) {
+    seed = seed * 1103515245u + 12345u;
+    int key = static_cast<int>(seed >> 8) % 50000;
+    m1[key] += i;
+    m2[key] += i;
+  }
+  EXPECT_EQ(m1.size(), m2.size());
+  for (auto const &item : m2) {
+    EXPECT_EQ(m1.at(item.first), item.second);
+  }
+}
+
+TEST(map_test, Assignment) {
+  s21::Map<int, int> m1 = {{1, 1}, {2, 2}};
+  s21::Map<int, int> m2 = {{3, 3}};
+  m2 = m1;
+  EXPECT_EQ(m2.size(), 2U);
+  EXPECT_EQ(m2.at(2), 2);
+  s21::Map<int, int> m3;
+  m3 = std::move(m1);
+  EXPECT_EQ(m3.size(), 2U);
+  EXPECT_EQ(m1.size(), 0U);
+  EXPECT_EQ(m3.at(1), 1);
+}
+
+TEST(map_test, CopyIsIndependent) {
+  s21::Map<int, int> m1;
+  for (int i = 0; i < 10000; ++i) m1.insert(i * 7 % 10000, i);
+  s21::Map<int, int> m2(m1);
+  s21::Map<int, int> m3;
+  m3 = m2;
+  m2[5] = -1;
+  m2.erase(m2.begin());
+  EXPECT_EQ(m1.size(), 10000U);
+  EXPECT_EQ(m2.size(), 9999U);
+  EXPECT_EQ(m3.size(), 10000U);
+  EXPECT_NE(m1.at(5), -1);
+  EXPECT_EQ(m3.at(5), m1.at(5));
+  auto it1 = m1.begin();
+  for (auto it3 = m3.begin(); it3 != m3.end(); ++it1, ++it3) {
+    EXPECT_EQ((*it1).first, (*it3).first);
+    EXPECT_EQ((*it1).second, (*it3).second);
+  }
+}
+
+TEST(map_test, RangeConstructor) {
+  std::vector<std::pair<int, int>> items;
+  for (int i = 0; i < 3000; ++i) items.emplace_back(i / 3, i);
+  s21::Map<int, int> m1(items.begin(), items.end());
+  std::map<int, int> m2(items.begin(), items.end());
+  EXPECT_EQ(m1.size(), m2.size());
+  auto it1 = m1.begin();
+  for (auto it2 = m2.begin(); it2 != m2.end(); ++it1, ++it2) {
+    EXPECT_EQ((*it1).first, (*it2).first);
+    EXPECT_EQ((*it1).second, (*it2).second);
+  }
+  items.emplace_back(-5, 1);
+  items.emplace_back(500, 1);
+  s21::Map<int, int> m3;
+  m3.insert(items.begin(), items.end());
+  EXPECT_EQ(m3.size(), 1001U);
+  EXPECT_EQ(m3.at(-5), 1);
+  EXPECT_EQ(m3.at(500), 1500);
+  m3.insert(items.begin(), items.begin() + 3);
+  EXPECT_EQ(m3.size(), 1001U);
+}
+
+TEST(map_test, RangeConstructorTags) {
+  std::map<int, std::string> source{{1, "a"}, {2, "b"}, {3, "c"}};
+  s21::Map<int, std::string> m1(s21::assume_unique, source.begin(),
+                                source.end());
+  EXPECT_EQ(m1.size(), 3U);
+  EXPECT_EQ(m1.at(2), "b");
+  std::vector<std::pair<int, std::string>> items{{1, "a"}, {1, "b"}, {4, "d"}};
+  s21::Map<int, std::string> m2(s21::assume_sorted, items.begin(),
+                                items.end());
+  EXPECT_EQ(m2.size(), 2U);
+  EXPECT_EQ(m2.at(1), "a");
+  m2[3] = "c";
+  EXPECT_EQ((*--m2.end()).second, "d");
+}
+
+TEST(map_test, TransparentLookup) {
+  // std::string cannot be built implicitly from std::string_view, so these
+  // lookups only compile when they go through std::less<> without a key
+  s21::Map<std::string, int, std::less<>> m1{
+      {"one", 1}, {"two", 2}, {"three", 3}};
+  const s21::Map<std::string, int, std::less<>> &m2 = m1;
+  std::string_view key = "two";
+  EXPECT_EQ(m1.at(key), 2);
+  EXPECT_EQ(m2.at(std::string_view("one")), 1);
+  EXPECT_TRUE(m1.contains(std::string_view("three")));
+  EXPECT_FALSE(m1.contains(std::string_view("four")));
+  EXPECT_EQ((*m1.find(key)).second, 2);
+  EXPECT_TRUE(m2.find(std::string_view("zero")) == m2.end());
+  EXPECT_EQ((*m1.find("three")).second, 3);
+}
+
+TEST(map_test, CustomCompare) {
+  s21::Map<std::string, int, std::greater<std::string>> m1{
+      {"a", 1}, {"c", 3}, {"b", 2}};
+  EXPECT_EQ((*m1.begin()).first, "c");
+  EXPECT_EQ((*--m1.end()).first, "a");
+  m1["d"] = 4;
+  EXPECT_EQ((*m1.begin()).second, 4);
+  EXPECT_TRUE(m1.find("e") == m1.end());
+  s21::Map<std::string, int, std::greater<std::string>> m2;
+  m2 = m1;
+  m2.erase(m2.find("c"));
+  EXPECT_EQ(m2.size(), 3U);
+  EXPECT_EQ(m1.at("c"), 3);
+}
+
+TEST(map_test, HintedInsert) {
+  s21::Map<int, std::string> m1;
+  std::map<int, std::string> m2;
+  for (int i = 0; i < 50; ++i) {
+    m1.insert(m1.end(), {i * 2, std::to_string(i)});
+    m2.insert(m2.end(), {i * 2, std::to_string(i)});
+  }
+  auto it = m1.emplace_hint(m1.find(8), 7, "seven");
+  EXPECT_EQ((*it).second, "seven");
+  m2.emplace_hint(m2.find(8), 7, "seven");
+  it = m1.emplace_hint(m1.begin(), 7, "other");
+  EXPECT_EQ((*it).second, "seven");
+  it = m1.insert(m1.begin(), {-3, "minus"});
+  EXPECT_TRUE(it == m1.begin());
+  m2.insert({-3, "minus"});
+  m1.erase(--m1.end());
+  m2.erase(--m2.end());
+  m1.insert(m1.end(), {97, "last"});
+  m2.insert(m2.end(), {97, "last"});
+  EXPECT_EQ(m1.size(), m2.size());
+  auto it2 = m2.begin();
+  for (auto i = m1.begin(); i != m1.end(); ++i, ++it2) {
+    EXPECT_EQ((*i).first, it2->first);
+    EXPECT_EQ((*i).second, it2->second);
+  }
+}
+
+TEST(map_test, ExtractAndRekey) {
+  s21::Map<int, std::string> m1{{1, "one"}, {2, "two"}, {3, "three"}};
+  auto handle = m1.extract(2);
+  EXPECT_EQ(handle.key(), 2);
+  EXPECT_EQ(handle.mapped(), "two");
+  EXPECT_FALSE(m1.contains(2));
+  handle.key() = 20;
+  auto result = m1.insert(std::move(handle));
+  EXPECT_TRUE(result.inserted);
+  EXPECT_EQ((*result.position).second, "two");
+  EXPECT_EQ(m1.at(20), "two");
+  handle = m1.extract(m1.find(1));
+  handle.key() = 3;
+  result = m1.insert(std::move(handle));
+  EXPECT_FALSE(result.inserted);
+  EXPECT_EQ(result.node.mapped(), "one");
+  EXPECT_EQ(m1.at(3), "three");
+  s21::Map<int, std::string> m2;
+  m2.insert(m2.end(), std::move(result.node));
+  EXPECT_EQ(m2.at(3), "one");
+  EXPECT_EQ(m1.size(), 2U);
+}
+
+TEST(map_test, TimeWindow) {
+  // a map from timestamps to readings, queried for [t0, t1) windows
+  s21::Map<long long, int> m1;
+  std::map<long long, int> m2;
+  for (int i = 0; i < 1000; ++i) {
+    m1.insert(1000LL * i + i % 7, i);
+    m2.insert({1000LL * i + i % 7, i});
+  }
+  for (long long t0 = -500; t0 < 1002000; t0 += 33333) {
+    long long t1 = t0 + 45000;
+    long long sum = 0;
+    for (const auto &entry : m1.range(t0, t1)) sum += entry.second;
+    long long expected = 0;
+    for (auto it = m2.lower_bound(t0); it != m2.lower_bound(t1); ++it) {
+      expected += it->second;
+    }
+    EXPECT_EQ(sum, expected);
+  }
+  EXPECT_EQ((*m1.lower_bound(2000)).second, 2);
+  EXPECT_EQ((*m1.upper_bound(2002)).second, 3);
+  EXPECT_TRUE(m1.lower_bound(2000000) == m1.end());
+  auto range = m1.equal_range(3003);
+  EXPECT_EQ((*range.first).second, 3);
+  EXPECT_TRUE(++range.first == range.second);
+  range = m1.equal_range(3004);
+  EXPECT_TRUE(range.first == range.second);
+  EXPECT_TRUE(m1.range(5000, 5000).empty());
+  s21::Map<std::string, int, std::less<>> m3{{"a1", 1}, {"b1", 2}, {"b2", 3}};
+  std::string_view from = "b";
+  std::string_view to = "c";
+  int sum = 0;
+  for (const auto &entry : m3.range(from, to)) sum += entry.second;
+  EXPECT_EQ(sum, 5);
+}
+
+TEST(map_test, TryEmplaceAndInsertOrAssign) {
+  s21::Map<int, std::string> m1{{1, "one"}};
+  std::string value = "uno";
+  auto result = m1.try_emplace(1, std::move(value));
+  EXPECT_FALSE(result.second);
+  // a present key leaves the arguments alone
+  EXPECT_EQ(value, "uno");
+  EXPECT_EQ((*result.first).second, "one");
+  result = m1.try_emplace(3, 3, 'x');
+  EXPECT_TRUE(result.second);
+  EXPECT_EQ(m1.at(3), "xxx");
+  EXPECT_EQ((*m1.try_emplace(m1.end(), 5, "five")).second, "five");
+  EXPECT_EQ((*m1.try_emplace(m1.begin(), 3, "three")).second, "xxx");
+  result = m1.insert_or_assign(3, std::string("three"));
+  EXPECT_FALSE(result.second);
+  EXPECT_EQ(m1.at(3), "three");
+  result = m1.insert_or_assign(4, value);
+  EXPECT_TRUE(result.second);
+  EXPECT_EQ(m1.at(4), "uno");
+  EXPECT_EQ(m1.size(), 4U);
+  s21::Map<std::string, std::unique_ptr<int>> m2;
+  std::string key = "answer";
+  m2[std::move(key)] = std::make_unique<int>(42);
+  m2.try_emplace("other", new int(7));
+  EXPECT_EQ(*m2["answer"], 42);
+  EXPECT_EQ(*m2.at("other"), 7);
+  EXPECT_EQ(m2["missing"], nullptr);
+  EXPECT_EQ(m2.size(), 3U);
+}
+
+TEST(map_test, StandardIterator) {
+  s21::Map<int, std::string> one{{2, "b"}, {1, "a"}, {3, "c"}};
+  s21::Map<int, std::string> two(one.begin(), one.end());
+  ASSERT_EQ(two.size(), 3);
+  ASSERT_EQ(std::distance(two.begin(), two.end()), 3);
+  auto it = std::next(two.begin());
+  ASSERT_EQ(it->first, 2);
+  ASSERT_EQ(it->second, "b");
+  ASSERT_EQ(std::prev(two.end())->second, "c");
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -583,4 +852,4 @@ int main(int argc, char **argv) {
 //   m2.erase(m2.begin());
 //   EXPECT_EQ(m1.size(), m2.size());
 //   EXPECT_ANY_THROW(m1.erase(m1.end()));
-// }
\ No newline at end of file
+// }
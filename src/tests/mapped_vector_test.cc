@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <string>
+
+#include "../s21_containersplus.h"
+
+namespace {
+struct Point {
+  int x;
+  double y;
+};
+
+// WrappingGrowth asks for a capacity whose size in bytes wraps around to the
+// size of the required elements
+struct WrappingGrowth {
+  static std::size_t NextCapacity(std::size_t, std::size_t required) {
+    return std::numeric_limits<std::size_t>::max() / sizeof(int) + 1 +
+           required;
+  }
+};
+
+std::string TempPath(const std::string &name) {
+  return testing::TempDir() + "s21_mapped_vector_" + name;
+}
+}  // namespace
+
+TEST(MappedVectorTest, CreateAndReopen) {
+  std::string path = TempPath("create");
+  {
+    s21::mapped_vector<int> one(path, s21::open_mode::create);
+    ASSERT_TRUE(one.is_open());
+    ASSERT_TRUE(one.empty());
+    for (int i = 0; i < 1000; ++i) one.push_back(i * i);
+    ASSERT_EQ(one.size(), 1000);
+    ASSERT_GE(one.capacity(), 1000);
+    one.sync();
+  }
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  ASSERT_EQ(static_cast<size_t>(file.tellg()), 1000 * sizeof(int));
+  const s21::mapped_vector<int> two(path);
+  ASSERT_TRUE(two.is_read_only());
+  ASSERT_EQ(two.size(), 1000);
+  ASSERT_EQ(two.capacity(), 1000);
+  ASSERT_EQ(two[999], 999 * 999);
+  ASSERT_EQ(two.at(10), 100);
+  EXPECT_THROW(two.at(1000), std::out_of_range);
+  int i = 0;
+  for (int value : two) {
+    ASSERT_EQ(value, i * i);
+    ++i;
+  }
+  std::remove(path.c_str());
+}
+
+TEST(MappedVectorTest, ReadWrite) {
+  std::string path = TempPath("read_write");
+  {
+    s21::mapped_vector<Point> one(path, s21::open_mode::create);
+    one.push_back({1, 1.5});
+    one.push_back({3, 3.5});
+  }
+  {
+    s21::mapped_vector<Point> two(path, s21::open_mode::read_write);
+    ASSERT_EQ(two.size(), 2);
+    two.insert(two.begin() + 1, {2, 2.5});
+    two.front().x = 10;
+    two.erase(two.end() - 1);
+    two.push_back({4, 4.5});
+    ASSERT_EQ(two.back().y, 4.5);
+  }
+  s21::mapped_vector<Point> three(path);
+  ASSERT_EQ(three.size(), 3);
+  ASSERT_EQ(three[0].x, 10);
+  ASSERT_EQ(three[1].x, 2);
+  ASSERT_EQ(three[2].x, 4);
+  std::remove(path.c_str());
+}
+
+TEST(MappedVectorTest, ReserveAndShrink) {
+  std::string path = TempPath("reserve");
+  s21::mapped_vector<double> one(path, s21::open_mode::create);
+  one.reserve(100);
+  ASSERT_EQ(one.capacity(), 100);
+  for (int i = 0; i < 10; ++i) one.push_back(i);
+  auto data = one.data();
+  one.push_back(10);
+  ASSERT_EQ(one.data(), data);
+  one.shrink_to_fit();
+  ASSERT_EQ(one.capacity(), 11);
+  ASSERT_EQ(one[10], 10);
+  one.pop_back();
+  one.clear();
+  ASSERT_TRUE(one.empty());
+  one.close();
+  ASSERT_FALSE(one.is_open());
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  ASSERT_EQ(file.tellg(), 0);
+  std::remove(path.c_str());
+}
+
+TEST(MappedVectorTest, Move) {
+  std::string path = TempPath("move");
+  s21::mapped_vector<int> one(path, s21::open_mode::create);
+  one.push_back(7);
+  s21::mapped_vector<int> two(std::move(one));
+  ASSERT_FALSE(one.is_open());
+  ASSERT_EQ(two[0], 7);
+  one = std::move(two);
+  ASSERT_TRUE(one.is_open());
+  ASSERT_EQ(one.size(), 1);
+  ASSERT_EQ(std::count(one.begin(), one.end(), 7), 1);
+  std::remove(path.c_str());
+}
+
+TEST(MappedVectorTest, Errors) {
+  EXPECT_THROW(s21::mapped_vector<int>(TempPath("missing")),
+               std::system_error);
+  std::string path = TempPath("errors");
+  {
+    std::ofstream file(path, std::ios::binary);
+    file << "abcde";
+  }
+  EXPECT_THROW(s21::mapped_vector<int>{path}, std::runtime_error);
+  s21::mapped_vector<char> one(path);
+  ASSERT_EQ(one.size(), 5);
+  ASSERT_EQ(one[4], 'e');
+  EXPECT_THROW(one.push_back('f'), std::logic_error);
+  EXPECT_THROW(one.reserve(10), std::logic_error);
+  s21::mapped_vector<char> two;
+  EXPECT_THROW(two.push_back('a'), std::logic_error);
+  std::remove(path.c_str());
+}
+
+TEST(MappedVectorTest, PopBackEmpty) {
+  std::string path = TempPath("pop_back");
+  {
+    s21::mapped_vector<int> one(path, s21::open_mode::create);
+    one.push_back(7);
+    one.pop_back();
+    one.pop_back();
+    ASSERT_TRUE(one.empty());
+    one.push_back(8);
+    ASSERT_EQ(one.size(), 1);
+    ASSERT_EQ(one.back(), 8);
+  }
+  std::remove(path.c_str());
+}
+
+TEST(MappedVectorTest, GrowthIsClamped) {
+  std::string path = TempPath("clamped");
+  {
+    s21::mapped_vector<int, WrappingGrowth> one(path, s21::open_mode::create);
+    one.reserve(2);
+    one.push_back(1);
+    one.push_back(2);
+    EXPECT_THROW(one.push_back(3), std::system_error);
+    ASSERT_EQ(one.size(), 2);
+    ASSERT_EQ(one.capacity(), 2);
+    ASSERT_EQ(one[1], 2);
+  }
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  ASSERT_EQ(static_cast<size_t>(file.tellg()), 2 * sizeof(int));
+  std::remove(path.c_str());
+}
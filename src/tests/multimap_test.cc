@@ -0,0 +1,305 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+namespace {
+template <typename Multimap>
+std::vector<std::pair<int, std::string>> Entries(const Multimap &m) {
+  std::vector<std::pair<int, std::string>> result;
+  for (auto it = m.begin(); it != m.end(); ++it) {
+    result.emplace_back((*it).first, (*it).second);
+  }
+  return result;
+}
+}  // namespace
+
+TEST(multimap_test, constructorInit) {
+  s21::multimap<int, std::string> m1 = {
+      {2, "b"}, {1, "a"}, {2, "c"}, {3, "d"}, {2, "e"}};
+  std::multimap<int, std::string> m2 = {
+      {2, "b"}, {1, "a"}, {2, "c"}, {3, "d"}, {2, "e"}};
+  EXPECT_EQ(m1.size(), m2.size());
+  EXPECT_EQ(Entries(m1), Entries(m2));
+}
+
+TEST(multimap_test, constructorEmpty) {
+  s21::multimap<int, std::string> m;
+  EXPECT_TRUE(m.empty());
+  EXPECT_EQ(m.size(), 0);
+  EXPECT_EQ(m.begin(), m.end());
+  EXPECT_GT(m.max_size(), 0);
+}
+
+TEST(multimap_test, constructorCopyAndMove) {
+  s21::multimap<int, std::string> m1 = {{1, "a"}, {1, "b"}, {2, "c"}};
+  s21::multimap<int, std::string> m2(m1);
+  EXPECT_EQ(Entries(m1), Entries(m2));
+  s21::multimap<int, std::string> m3(std::move(m1));
+  EXPECT_EQ(m1.size(), 0);
+  EXPECT_EQ(Entries(m2), Entries(m3));
+  s21::multimap<int, std::string> m4;
+  m4 = m3;
+  EXPECT_EQ(Entries(m3), Entries(m4));
+  m4 = std::move(m3);
+  EXPECT_EQ(Entries(m2), Entries(m4));
+  EXPECT_TRUE(m3.empty());
+}
+
+TEST(multimap_test, RangeConstructor) {
+  std::vector<std::pair<int, std::string>> sorted = {
+      {1, "a"}, {1, "b"}, {2, "c"}, {4, "d"}, {4, "e"}};
+  s21::multimap<int, std::string> m1(sorted.begin(), sorted.end());
+  s21::multimap<int, std::string> m2(s21::assume_sorted, sorted.begin(),
+                                     sorted.end());
+  EXPECT_EQ(Entries(m1), sorted);
+  EXPECT_EQ(Entries(m2), sorted);
+  std::vector<std::pair<int, std::string>> shuffled = {
+      {4, "d"}, {1, "a"}, {2, "c"}, {1, "b"}, {4, "e"}};
+  s21::multimap<int, std::string> m3(shuffled.begin(), shuffled.end());
+  EXPECT_EQ(Entries(m3), sorted);
+}
+
+TEST(multimap_test, InsertKeepsOrderOfEqualKeys) {
+  s21::multimap<int, std::string> m1;
+  std::multimap<int, std::string> m2;
+  const char *names[] = {"a", "b", "c", "d", "e", "f", "g", "h"};
+  for (int i = 0; i < 8; ++i) {
+    auto it = m1.insert({i % 3, names[i]});
+    m2.insert({i % 3, names[i]});
+    EXPECT_EQ((*it).second, names[i]);
+  }
+  m1.insert(1, "i");
+  m2.insert({1, "i"});
+  EXPECT_EQ(Entries(m1), Entries(m2));
+}
+
+TEST(multimap_test, CountAndEqualRange) {
+  s21::multimap<int, std::string> m = {
+      {5, "a"}, {1, "b"}, {5, "c"}, {3, "d"}, {5, "e"}};
+  EXPECT_EQ(m.count(5), 3);
+  EXPECT_EQ(m.count(1), 1);
+  EXPECT_EQ(m.count(4), 0);
+  auto range = m.equal_range(5);
+  std::vector<std::string> values;
+  for (auto it = range.first; it != range.second; ++it) {
+    values.push_back((*it).second);
+  }
+  EXPECT_EQ(values, (std::vector<std::string>{"a", "c", "e"}));
+  EXPECT_EQ(range.second, m.end());
+  auto missing = m.equal_range(4);
+  EXPECT_EQ(missing.first, missing.second);
+  EXPECT_EQ((*missing.first).first, 5);
+  const auto &cm = m;
+  auto const_range = cm.equal_range(3);
+  EXPECT_EQ((*const_range.first).second, "d");
+}
+
+TEST(multimap_test, FindAndBounds) {
+  s21::multimap<int, std::string> m = {
+      {2, "a"}, {2, "b"}, {4, "c"}, {6, "d"}};
+  EXPECT_EQ((*m.find(2)).second, "a");
+  EXPECT_EQ(m.find(3), m.end());
+  EXPECT_TRUE(m.contains(4));
+  EXPECT_FALSE(m.contains(5));
+  EXPECT_EQ((*m.lower_bound(3)).first, 4);
+  EXPECT_EQ((*m.upper_bound(2)).first, 4);
+  EXPECT_EQ(m.upper_bound(6), m.end());
+  std::vector<std::string> values;
+  for (const auto &entry : m.range(2, 6)) values.push_back(entry.second);
+  EXPECT_EQ(values, (std::vector<std::string>{"a", "b", "c"}));
+}
+
+TEST(multimap_test, TransparentLookup) {
+  s21::multimap<std::string, int, std::less<>> m = {
+      {"beta", 1}, {"alpha", 2}, {"beta", 3}};
+  std::string_view key = "beta";
+  EXPECT_EQ(m.count(key), 2);
+  EXPECT_TRUE(m.contains(key));
+  EXPECT_EQ((*m.find(key)).second, 1);
+  EXPECT_EQ((*m.lower_bound(std::string_view("b"))).first, "beta");
+  EXPECT_EQ(m.upper_bound(key), m.end());
+}
+
+TEST(multimap_test, HintedInsert) {
+  s21::multimap<int, int> m;
+  for (int i = 0; i < 1000; ++i) m.insert(m.end(), {i / 10, i});
+  EXPECT_EQ(m.size(), 1000);
+  int expected = 0;
+  for (auto it = m.begin(); it != m.end(); ++it, ++expected) {
+    EXPECT_EQ((*it).first, expected / 10);
+    EXPECT_EQ((*it).second, expected);
+  }
+  auto it = m.insert(m.find(50), {50, -1});
+  EXPECT_EQ((*it).second, -1);
+  EXPECT_EQ(m.count(50), 11);
+  EXPECT_EQ((*m.find(50)).second, -1);
+  auto placed = m.insert(m.begin(), {99, -2});
+  EXPECT_EQ((*placed).first, 99);
+  EXPECT_EQ(++placed, m.end());
+  EXPECT_EQ(m.count(99), 11);
+  auto emplaced = m.emplace_hint(m.end(), 0, -3);
+  EXPECT_EQ((*emplaced).second, -3);
+  EXPECT_EQ(m.count(0), 11);
+}
+
+TEST(multimap_test, EraseAndClear) {
+  s21::multimap<int, std::string> m = {{1, "a"}, {1, "b"}, {2, "c"}};
+  m.erase(m.find(1));
+  EXPECT_EQ(m.count(1), 1);
+  EXPECT_EQ((*m.find(1)).second, "b");
+  m.clear();
+  EXPECT_TRUE(m.empty());
+  m.insert(7, "x");
+  EXPECT_EQ(m.size(), 1);
+}
+
+TEST(multimap_test, ExtractAndInsertNode) {
+  s21::multimap<int, std::string> m1 = {{1, "a"}, {2, "b"}, {2, "c"}};
+  auto handle = m1.extract(2);
+  ASSERT_FALSE(handle.empty());
+  EXPECT_EQ(handle.key(), 2);
+  EXPECT_EQ(handle.mapped(), "b");
+  EXPECT_EQ(m1.count(2), 1);
+  handle.key() = 1;
+  auto it = m1.insert(std::move(handle));
+  EXPECT_TRUE(handle.empty());
+  EXPECT_EQ((*it).second, "b");
+  EXPECT_EQ(Entries(m1), (std::vector<std::pair<int, std::string>>{
+                             {1, "a"}, {1, "b"}, {2, "c"}}));
+  EXPECT_TRUE(m1.extract(5).empty());
+  s21::multimap<int, std::string> m2;
+  m2.insert(m2.end(), m1.extract(m1.begin()));
+  EXPECT_EQ(m2.size(), 1);
+  EXPECT_EQ((*m2.begin()).second, "a");
+}
+
+TEST(multimap_test, MergeKeepsEveryNode) {
+  s21::multimap<int, std::string> m1 = {{1, "a"}, {3, "b"}};
+  s21::multimap<int, std::string> m2 = {{1, "c"}, {2, "d"}, {3, "e"}};
+  m1.merge(m2);
+  EXPECT_TRUE(m2.empty());
+  EXPECT_EQ(Entries(m1),
+            (std::vector<std::pair<int, std::string>>{
+                {1, "a"}, {1, "c"}, {2, "d"}, {3, "b"}, {3, "e"}}));
+  m1.merge(m1);
+  EXPECT_EQ(m1.size(), 5);
+}
+
+TEST(multimap_test, SwapAndEmplace) {
+  s21::multimap<int, std::string> m1 = {{1, "a"}};
+  s21::multimap<int, std::string> m2;
+  auto it = m2.emplace(2, "b");
+  EXPECT_EQ(it->second, "b");
+  it = m2.emplace(std::pair<int, std::string>(2, "c"));
+  EXPECT_EQ(it->second, "c");
+  EXPECT_EQ(std::prev(it)->second, "b");
+  m1.swap(m2);
+  EXPECT_EQ(m1.count(2), 2);
+  EXPECT_EQ(m2.count(1), 1);
+}
+
+TEST(multimap_test, LargeRandomMatchesStd) {
+  s21::multimap<int, int> m1;
+  std::multimap<int, int> m2;
+  unsigned seed = 12345;
+  for (int i = 0; i < 20000; ++i) {
+    seed = seed * 1103515245u + 12345u;
+    int key = static_cast<int>(seed >> 16) % 500;
+    m1.insert(key, i);
+    m2.insert({key, i});
+  }
+  for (int i = 0; i < 5000; ++i) {
+    seed = seed * 1103515245u + 12345u;
+    int key = static_cast<int>(seed >> 16) % 500;
+    auto it1 = m1.find(key);
+    auto it2 = m2.find(key);
+    ASSERT_EQ(it1 == m1.end(), it2 == m2.end());
+    if (it2 != m2.end()) {
+      m1.erase(it1);
+      m2.erase(it2);
+    }
+  }
+  ASSERT_EQ(m1.size(), m2.size());
+  auto it1 = m1.begin();
+  for (auto it2 = m2.begin(); it2 != m2.end(); ++it1, ++it2) {
+    ASSERT_EQ((*it1).first, it2->first);
+    ASSERT_EQ((*it1).second, it2->second);
+  }
+  for (int key = 0; key < 500; ++key) ASSERT_EQ(m1.count(key), m2.count(key));
+}
+
+TEST(multimap_test, MutableIterator) {
+  using multimap = s21::multimap<int, std::string>;
+  static_assert(std::is_same_v<decltype(*std::declval<multimap::iterator>()),
+                               std::pair<const int, std::string> &>);
+  static_assert(
+      std::is_same_v<decltype(*std::declval<multimap::const_iterator>()),
+                     const std::pair<const int, std::string> &>);
+  static_assert(
+      std::is_convertible_v<multimap::iterator, multimap::const_iterator>);
+  static_assert(
+      !std::is_convertible_v<multimap::const_iterator, multimap::iterator>);
+  multimap m = {{1, "a"}, {2, "b"}, {2, "c"}, {3, "d"}};
+  m.find(1)->second = "x";
+  auto range = m.equal_range(2);
+  for (auto it = range.first; it != range.second; ++it) it->second += "!";
+  for (auto &[key, value] : m) {
+    if (key == 3) value = "y";
+  }
+  (*m.lower_bound(3)).second += "z";
+  EXPECT_EQ(Entries(m), (std::vector<std::pair<int, std::string>>{
+                            {1, "x"}, {2, "b!"}, {2, "c!"}, {3, "yz"}}));
+  multimap::const_iterator first = m.begin();
+  EXPECT_EQ(first, m.begin());
+  EXPECT_NE(m.end(), first);
+  m.erase(first);
+  EXPECT_EQ(m.begin()->second, "b!");
+  auto handle = m.extract(3);
+  handle.key() = 0;
+  EXPECT_EQ(m.insert(std::move(handle))->first, 0);
+  EXPECT_EQ(m.begin()->second, "yz");
+}
+
+TEST(multimap_test, RekeyNode) {
+  s21::multimap<std::string, int> m = {{"b", 1}, {"b", 2}, {"c", 3}};
+  auto first = m.extract("b");
+  auto second = m.extract(m.find("c"));
+  first.key() = "d";
+  EXPECT_EQ(first.key(), "d");
+  EXPECT_EQ(first.mapped(), 1);
+  first.swap(second);
+  EXPECT_EQ(second.key(), "d");
+  EXPECT_EQ(first.key(), "c");
+  second.key() += "d";
+  m.insert(std::move(second));
+  m.insert(m.begin(), std::move(first));
+  EXPECT_TRUE(first.empty());
+  std::vector<std::pair<std::string, int>> entries(m.begin(), m.end());
+  EXPECT_EQ(entries, (std::vector<std::pair<std::string, int>>{
+                         {"b", 2}, {"c", 3}, {"dd", 1}}));
+}
+
+TEST(multimap_test, EmplaceForwardsArguments) {
+  s21::multimap<int, std::unique_ptr<int>> m;
+  auto it = m.emplace(1, std::make_unique<int>(10));
+  EXPECT_EQ(*it->second, 10);
+  it = m.emplace(std::piecewise_construct, std::forward_as_tuple(1),
+                 std::forward_as_tuple(new int(20)));
+  EXPECT_EQ(*it->second, 20);
+  EXPECT_EQ(std::prev(it), m.begin());
+  it = m.emplace_hint(m.begin(), 0, std::make_unique<int>(30));
+  EXPECT_EQ(it, m.begin());
+  it = m.emplace_hint(m.end(), 1, nullptr);
+  EXPECT_EQ(std::next(it), m.end());
+  EXPECT_EQ(m.count(1), 3);
+  EXPECT_EQ(m.size(), 4);
+}
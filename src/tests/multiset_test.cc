@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 
 #include <set>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include "../s21_containersplus.h"
 
@@ -632,6 +635,279 @@ TEST(multiset_test, ConstBoundsTest_3) {
   EXPECT_EQ(*i, *j);
 }
 
+TEST(multiset_test, LargeRandom) {
+  s21::multiset<int> m1;
+  std::multiset<int> m2;
+  unsigned seed = 42;
+  for (int i = 0; i < 100000; ++i) {
+    seed = seed * 1103515245u + 12345u;
+    int key = static_cast<int>(seed >> 8) % 1000;
+    if (i % 4 == 3) {
+      auto it = m1.find(key);
+      if (it != m1.end()) m1.erase(it);
+      auto it2 = m2.find(key);
+      if (it2 != m2.end()) m2.erase(it2);
+    } else {
+      m1.insert(key);
+      m2.insert(key);
+    }
+  }
+  EXPECT_EQ(m1.size(), m2.size());
+  EXPECT_TRUE(std::equal(m2.begin(), m2.end(), m1.begin()));
+  for (int key = 0; key < 1000; key += 37) {
+    EXPECT_EQ(m1.count(key), m2.count(key));
+  }
+}
+
+TEST(multiset_test, LargeSortedMerge) {
+  s21::multiset<int> m1;
+  s21::multiset<int> m2;
+  for (int i = 0; i < 50000; ++i) {
+    m1.insert(i);
+    m2.insert(i / 2);
+  }
+  m1.merge(m2);
+  EXPECT_EQ(m1.size(), 100000U);
+  EXPECT_EQ(m2.size(), 0U);
+  EXPECT_TRUE(std::is_sorted(m1.begin(), m1.end()));
+  EXPECT_EQ(m1.count(10), 3U);
+}
+
+TEST(multiset_test, ClearLargeAndReuse) {
+  s21::multiset<int> m1;
+  for (int i = 0; i < 300000; ++i) m1.insert(i % 1000);
+  s21::multiset<int> m2(m1);
+  m1.clear();
+  EXPECT_TRUE(m1.empty());
+  EXPECT_TRUE(m1.begin() == m1.end());
+  m1.insert(5);
+  EXPECT_EQ(m1.count(5), 1U);
+  EXPECT_EQ(m2.count(5), 300U);
+}
+
+TEST(multiset_test, RangeConstructor) {
+  std::vector<int> keys;
+  for (int i = 0; i < 4000; ++i) keys.push_back(i / 4);
+  s21::multiset<int> m1(keys.begin(), keys.end());
+  s21::multiset<int> m2(s21::assume_sorted, keys.begin(), keys.end());
+  EXPECT_TRUE(std::equal(keys.begin(), keys.end(), m1.begin()));
+  EXPECT_TRUE(std::equal(keys.begin(), keys.end(), m2.begin()));
+  keys.push_back(7);
+  keys.push_back(-1);
+  s21::multiset<int> m3;
+  m3.insert(keys.begin(), keys.end());
+  std::multiset<int> m4(keys.begin(), keys.end());
+  EXPECT_EQ(m1.size(), 4000U);
+  EXPECT_EQ(m2.size(), 4000U);
+  EXPECT_EQ(m1.count(999), 4U);
+  EXPECT_EQ(m3.size(), m4.size());
+  EXPECT_TRUE(std::equal(m4.begin(), m4.end(), m3.begin()));
+  EXPECT_EQ(m3.count(7), 5U);
+}
+
+TEST(multiset_test, CustomCompareAndTransparentLookup) {
+  s21::multiset<int, std::greater<int>> m1{3, 1, 3, 2, 3};
+  std::multiset<int, std::greater<int>> m2{3, 1, 3, 2, 3};
+  EXPECT_TRUE(std::equal(m2.begin(), m2.end(), m1.begin()));
+  EXPECT_EQ(m1.count(3), 3U);
+  EXPECT_EQ(*m1.lower_bound(2), 2);
+  EXPECT_EQ(*m1.upper_bound(3), 2);
+  s21::multiset<std::string, std::less<>> m3{"b", "a", "b", "c"};
+  std::string_view key = "b";
+  EXPECT_EQ(m3.count(key), 2U);
+  EXPECT_TRUE(m3.contains(key));
+  EXPECT_EQ(*m3.find(key), "b");
+  auto range = m3.equal_range(key);
+  EXPECT_TRUE(range.first == m3.lower_bound(key));
+  EXPECT_TRUE(range.second == m3.upper_bound(key));
+  EXPECT_EQ(*range.second, "c");
+  EXPECT_TRUE(m3.find(std::string_view("d")) == m3.end());
+}
+
+TEST(multiset_test, HintedInsert) {
+  s21::multiset<int> m1;
+  std::multiset<int> m2;
+  for (int i = 0; i < 30; ++i) {
+    m1.insert(m1.end(), i / 3);
+    m2.insert(m2.end(), i / 3);
+  }
+  // an equal key goes right before an equal hint
+  auto hint = m1.upper_bound(3);
+  --hint;
+  auto it = m1.insert(hint, 3);
+  EXPECT_TRUE(++it == hint);
+  hint = m1.find(7);
+  it = m1.emplace_hint(hint, 6);
+  EXPECT_TRUE(++it == hint);
+  // a wrong hint still keeps the order
+  m1.insert(m1.begin(), 5);
+  m1.insert(m1.end(), 0);
+  EXPECT_EQ(*m1.insert(m1.end(), 9), 9);
+  for (int key : {3, 6, 5, 0, 9}) m2.insert(key);
+  EXPECT_EQ(m1.size(), m2.size());
+  EXPECT_TRUE(std::equal(m2.begin(), m2.end(), m1.begin()));
+  EXPECT_EQ(m1.count(9), 4U);
+}
+
+TEST(multiset_test, ExtractAndInsertNode) {
+  s21::multiset<int> m1{1, 2, 2, 3};
+  s21::multiset<int> m2{2};
+  auto handle = m1.extract(2);
+  EXPECT_EQ(handle.value(), 2);
+  EXPECT_EQ(m1.count(2), 1U);
+  EXPECT_TRUE(m1.extract(5).empty());
+  auto it = m2.insert(std::move(handle));
+  EXPECT_TRUE(handle.empty());
+  EXPECT_EQ(m2.count(2), 2U);
+  EXPECT_TRUE(++it == m2.end());
+  handle = m1.extract(m1.begin());
+  handle.value() = 2;
+  it = m2.insert(m2.begin(), std::move(handle));
+  EXPECT_TRUE(it == m2.begin());
+  EXPECT_EQ(m2.count(2), 3U);
+  EXPECT_EQ(m1.size(), 2U);
+}
+
+TEST(multiset_test, RankedOrderStatistics) {
+  s21::ranked_multiset<int> m1;
+  std::multiset<int> m2;
+  EXPECT_LT(sizeof(s21::multiset<int>::node),
+            sizeof(s21::ranked_multiset<int>::node));
+  // Check() compares every order statistic with a walk over m2
+  auto check = [&m1, &m2] {
+    ASSERT_EQ(m1.size(), m2.size());
+    std::size_t index = 0;
+    for (int key : m2) {
+      ASSERT_EQ(*m1.nth(index), key);
+      ASSERT_EQ(m1.count_less(key), std::size_t(std::distance(
+                                        m2.begin(), m2.lower_bound(key))));
+      ASSERT_EQ(m1.rank(key), std::size_t(std::distance(
+                                  m2.begin(), m2.upper_bound(key))));
+      ++index;
+    }
+    EXPECT_TRUE(m1.nth(m1.size()) == m1.end());
+  };
+  unsigned seed = 5;
+  for (int i = 0; i < 3000; ++i) {
+    seed = seed * 1103515245u + 12345u;
+    int key = static_cast<int>(seed >> 8) % 200;
+    if (i % 3 == 2) {
+      auto it = m1.find(key);
+      if (it != m1.end()) m1.erase(it);
+      auto jt = m2.find(key);
+      if (jt != m2.end()) m2.erase(jt);
+    } else {
+      m1.insert(key);
+      m2.insert(key);
+    }
+  }
+  check();
+  EXPECT_EQ(m1.count_less(-1), 0U);
+  EXPECT_EQ(m1.rank(1000), m1.size());
+  s21::ranked_multiset<int> sorted(m2.begin(), m2.end());
+  std::vector<int> more{7, 7, 250, -3};
+  s21::ranked_multiset<int> other(more.begin(), more.end());
+  m1.merge(other);
+  m2.insert(more.begin(), more.end());
+  auto handle = m1.extract(250);
+  m1.insert(m1.begin(), std::move(handle));
+  check();
+  s21::ranked_multiset<int> copy(m1);
+  m1.clear();
+  m1.swap(copy);
+  check();
+  std::size_t index = 0;
+  for (auto it = sorted.begin(); it != sorted.end(); ++it, ++index) {
+    ASSERT_TRUE(sorted.nth(index) == it);
+  }
+}
+
+TEST(multiset_test, RunLengthMatchesStd) {
+  s21::run_length_multiset<int> m1;
+  std::multiset<int> m2;
+  // check() compares the elements in both directions and every count
+  auto check = [&m1, &m2] {
+    ASSERT_EQ(m1.size(), m2.size());
+    ASSERT_TRUE(std::equal(m2.begin(), m2.end(), m1.begin()));
+    auto it = m1.end();
+    for (auto jt = m2.rbegin(); jt != m2.rend(); ++jt) ASSERT_EQ(*--it, *jt);
+    ASSERT_TRUE(it == m1.begin());
+    for (int key = -5; key < 60; ++key) {
+      ASSERT_EQ(m1.count(key), m2.count(key));
+      std::size_t in_range = 0;
+      auto range = m1.equal_range(key);
+      for (auto kt = range.first; kt != range.second; ++kt) ++in_range;
+      ASSERT_EQ(in_range, m2.count(key));
+    }
+  };
+  unsigned seed = 9;
+  for (int i = 0; i < 2000; ++i) {
+    seed = seed * 1103515245u + 12345u;
+    int key = static_cast<int>(seed >> 8) % 50;
+    if (i % 3 == 2) {
+      auto it = m1.find(key);
+      if (it != m1.end()) m1.erase(it);
+      auto jt = m2.find(key);
+      if (jt != m2.end()) m2.erase(jt);
+    } else if (i % 3 == 1) {
+      // every element added to a run becomes its last one
+      auto it = m1.insert(m1.begin(), key);
+      ASSERT_EQ(*it, key);
+      ASSERT_TRUE(++it == m1.upper_bound(key));
+      m2.insert(key);
+    } else {
+      m1.insert(key);
+      m2.insert(key);
+    }
+  }
+  check();
+  std::vector<int> more{3, 3, 3, 8, 70, 70, 1};
+  s21::run_length_multiset<int> built(more.begin(), more.end());
+  EXPECT_EQ(built.size(), more.size());
+  EXPECT_EQ(built.count(3), 3U);
+  EXPECT_EQ(built.count(70), 2U);
+  m1.merge(built);
+  m2.insert(more.begin(), more.end());
+  EXPECT_TRUE(built.empty());
+  check();
+  auto handle = m1.extract(70);
+  EXPECT_EQ(handle.value(), 70);
+  EXPECT_EQ(m1.count(70), 1U);
+  m1.insert(std::move(handle));
+  EXPECT_TRUE(handle.empty());
+  EXPECT_EQ(m1.count(70), 2U);
+  s21::run_length_multiset<int> copy(m1);
+  m1.clear();
+  m1.swap(copy);
+  check();
+}
+
+TEST(multiset_test, RankedRunLength) {
+  s21::multiset<int, std::less<int>, std::allocator<int>,
+                s21::multiset_options::kRanked |
+                    s21::multiset_options::kRunLength>
+      m1{5, 1, 5, 5, 9, 1, 7};
+  std::multiset<int> m2{5, 1, 5, 5, 9, 1, 7};
+  for (int i = 0; i < 100; ++i) {
+    m1.insert(i % 10);
+    m2.insert(i % 10);
+  }
+  m1.erase(m1.find(5));
+  m2.erase(m2.find(5));
+  std::size_t index = 0;
+  for (auto it = m1.begin(); it != m1.end(); ++it, ++index) {
+    ASSERT_TRUE(m1.nth(index) == it);
+  }
+  ASSERT_EQ(index, m2.size());
+  for (int key = -1; key < 11; ++key) {
+    ASSERT_EQ(m1.count(key), m2.count(key));
+    ASSERT_EQ(m1.count_less(key), std::size_t(std::distance(
+                                      m2.begin(), m2.lower_bound(key))));
+    ASSERT_EQ(m1.rank(key), std::size_t(std::distance(
+                                m2.begin(), m2.upper_bound(key))));
+  }
+}
+
 // throw cause leaks on Mac
 
 // TEST(multiset_test, throw_test) {
@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <set>
+#include <string>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+
+namespace {
+using PoolSet = s21::set<int, std::less<int>, s21::NodePoolAllocator<int>>;
+using PoolMap =
+    s21::Map<int, std::string, std::less<int>,
+             s21::NodePoolAllocator<std::pair<const int, std::string>>>;
+}  // namespace
+
+TEST(NodePoolTest, ChunksAreAlignedAndRecycled) {
+  s21::NodePool pool(4);
+  void *one = pool.Allocate(20);
+  void *two = pool.Allocate(20);
+  ASSERT_EQ(reinterpret_cast<std::uintptr_t>(one) %
+                alignof(std::max_align_t),
+            0U);
+  ASSERT_EQ(reinterpret_cast<std::uintptr_t>(two) %
+                alignof(std::max_align_t),
+            0U);
+  ASSERT_TRUE(pool.Fits(20, alignof(int)));
+  ASSERT_FALSE(pool.Fits(200, alignof(int)));
+  pool.Deallocate(one);
+  ASSERT_EQ(pool.Allocate(20), one);
+  for (int i = 0; i < 3; ++i) pool.Allocate(20);
+  const s21::NodePoolStats &stats = pool.stats();
+  ASSERT_EQ(stats.allocations, 6U);
+  ASSERT_EQ(stats.deallocations, 1U);
+  ASSERT_EQ(stats.reused, 1U);
+  ASSERT_EQ(stats.in_use, 5U);
+  ASSERT_EQ(stats.free, 0U);
+  ASSERT_EQ(stats.blocks, 2U);
+}
+
+TEST(NodePoolTest, SetReusesErasedNodes) {
+  PoolSet one(s21::NodePoolAllocator<int>(64));
+  for (int i = 0; i < 1000; ++i) one.insert(i);
+  s21::NodePoolStats before = one.get_allocator().stats();
+  // the header node comes from the pool as well
+  ASSERT_EQ(before.in_use, 1001U);
+  for (int i = 0; i < 1000; i += 2) one.erase(one.find(i));
+  for (int i = 1000; i < 1500; ++i) one.insert(i);
+  s21::NodePoolStats after = one.get_allocator().stats();
+  ASSERT_EQ(after.blocks, before.blocks);
+  ASSERT_EQ(after.reused, 500U);
+  ASSERT_EQ(after.in_use, 1001U);
+  ASSERT_EQ(one.size(), 1000U);
+}
+
+TEST(NodePoolTest, DuplicateKeysDoNotAllocate) {
+  PoolSet one{1, 2, 3};
+  std::size_t allocations = one.get_allocator().stats().allocations;
+  ASSERT_FALSE(one.insert(2).second);
+  ASSERT_EQ(one.get_allocator().stats().allocations, allocations);
+  PoolMap two;
+  two[5] = "five";
+  allocations = two.get_allocator().stats().allocations;
+  two[5] += "!";
+  two.insert(5, "ignored");
+  ASSERT_EQ(two.get_allocator().stats().allocations, allocations);
+  ASSERT_EQ(two.at(5), "five!");
+}
+
+TEST(NodePoolTest, CopiesGetTheirOwnPool) {
+  PoolSet one{1, 2, 3};
+  PoolSet two(one);
+  ASSERT_TRUE(one.get_allocator() != two.get_allocator());
+  two.insert(4);
+  ASSERT_EQ(one.get_allocator().stats().in_use, 4U);
+  ASSERT_EQ(two.get_allocator().stats().in_use, 5U);
+  PoolSet three(std::move(two));
+  // the moved-from set keeps an empty header from the same pool
+  ASSERT_TRUE(three.get_allocator() == two.get_allocator());
+  ASSERT_EQ(three.get_allocator().stats().in_use, 6U);
+  ASSERT_EQ(three.size(), 4U);
+}
+
+TEST(NodePoolTest, Merge) {
+  PoolSet one{1, 3, 5};
+  PoolSet shared(one.get_allocator());
+  shared.insert(2);
+  shared.insert(3);
+  std::size_t allocations = one.get_allocator().stats().allocations;
+  one.merge(shared);
+  // a shared pool lets nodes be relinked
+  ASSERT_EQ(one.get_allocator().stats().allocations, allocations);
+  ASSERT_EQ(one.size(), 4U);
+  ASSERT_EQ(shared.size(), 1U);
+  PoolSet other{7, 8};
+  one.merge(other);
+  ASSERT_EQ(one.size(), 6U);
+  ASSERT_TRUE(other.empty());
+  ASSERT_EQ(other.get_allocator().stats().in_use, 1U);
+  std::set<int> expected{1, 2, 3, 5, 7, 8};
+  ASSERT_TRUE(std::equal(expected.begin(), expected.end(), one.begin()));
+}
+
+TEST(NodePoolTest, NodeHandlesDoNotAllocate) {
+  PoolMap one;
+  one[1] = "one";
+  one[2] = "two";
+  PoolMap shared(one.get_allocator());
+  std::size_t allocations = one.get_allocator().stats().allocations;
+  auto handle = one.extract(1);
+  handle.key() = 10;
+  ASSERT_TRUE(shared.insert(std::move(handle)).inserted);
+  ASSERT_EQ(one.get_allocator().stats().allocations, allocations);
+  ASSERT_EQ(shared.at(10), "one");
+  // a handle outlives its map and still frees the node into its pool
+  handle = shared.extract(10);
+  {
+    PoolMap other;
+    ASSERT_TRUE(other.insert(std::move(handle)).inserted);
+    ASSERT_EQ(other.at(10), "one");
+    handle = one.extract(2);
+  }
+  std::size_t in_use = one.get_allocator().stats().in_use;
+  handle = PoolMap::node_type();
+  ASSERT_EQ(one.get_allocator().stats().in_use, in_use - 1);
+}
+
+TEST(NodePoolTest, MultisetChurn) {
+  s21::multiset<int, std::less<int>, s21::NodePoolAllocator<int>> one;
+  std::multiset<int> two;
+  unsigned seed = 3;
+  for (int i = 0; i < 20000; ++i) {
+    seed = seed * 1103515245u + 12345u;
+    int key = static_cast<int>(seed >> 8) % 100;
+    if (i % 2) {
+      auto it = one.find(key);
+      if (it != one.end()) one.erase(it);
+      auto jt = two.find(key);
+      if (jt != two.end()) two.erase(jt);
+    } else {
+      one.insert(key);
+      two.insert(key);
+    }
+  }
+  ASSERT_EQ(one.size(), two.size());
+  ASSERT_TRUE(std::equal(two.begin(), two.end(), one.begin()));
+  const s21::NodePoolStats &stats = one.get_allocator().stats();
+  ASSERT_EQ(stats.in_use, one.size() + 1);
+  ASSERT_EQ(stats.in_use + stats.free, stats.allocations - stats.reused);
+}
@@ -1,6 +1,11 @@
 #include <gtest/gtest.h>
 
+#include <iterator>
 #include <set>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include "../s21_containers.h"
 
@@ -517,10 +522,266 @@ TEST(set_test, Const_Find_Contains_Test) {
   EXPECT_EQ(res1, true);
 }
 
+TEST(set_test, LargeSorted) {
+  s21::set<int> m1;
+  std::set<int> m2;
+  for (int i = 0; i < 100000; ++i) {
+    m1.insert(i);
+    m2.insert(i);
+  }
+  for (int i = 0; i < 100000; i += 2) {
+    m1.erase(m1.find(i));
+    m2.erase(i);
+  }
+  EXPECT_EQ(m1.size(), m2.size());
+  EXPECT_TRUE(std::equal(m2.begin(), m2.end(), m1.begin()));
+}
+
+TEST(set_test, LargeRandom) {
+  s21::set<int> m1;
+  std::set<int> m2;
+  unsigned seed = 42;
+  for (int i = 0; i < 100000; ++i) {
+    seed = seed * 1103515245u + 12345u;
+    int key = static_cast<int>(seed >> 8) % 50000;
+    if (i % 3 == 2) {
+      auto it = m1.find(key);
+      if (it != m1.end()) m1.erase(it);
+      m2.erase(key);
+    } else {
+      EXPECT_EQ(m1.insert(key).second, m2.insert(key).second);
+    }
+  }
+  EXPECT_EQ(m1.size(), m2.size());
+  EXPECT_TRUE(std::equal(m2.begin(), m2.end(), m1.begin()));
+}
+
+TEST(set_test, EraseKeepsIterators) {
+  s21::set<int> m1 = {5, 2, 8, 1, 3, 7, 9};
+  auto it = m1.find(7);
+  m1.erase(m1.find(5));
+  EXPECT_EQ(*it, 7);
+  EXPECT_EQ(*(++it), 8);
+}
+
+TEST(set_test, IterateBothWays) {
+  s21::set<int> m1;
+  std::set<int> m2;
+  for (int i = 0; i < 1000; ++i) {
+    m1.insert(i * 7 % 1000);
+    m2.insert(i * 7 % 1000);
+  }
+  auto it1 = m1.end();
+  for (auto it2 = m2.rbegin(); it2 != m2.rend(); ++it2) EXPECT_EQ(*--it1, *it2);
+  EXPECT_TRUE(it1 == m1.begin());
+  EXPECT_TRUE(--it1 == m1.end());
+  EXPECT_EQ(*++it1, 999);
+}
+
+TEST(set_test, RangeConstructor) {
+  std::vector<int> sorted;
+  for (int i = 0; i < 5000; ++i) sorted.push_back(i / 2);
+  s21::set<int> m1(sorted.begin(), sorted.end());
+  std::set<int> m2(sorted.begin(), sorted.end());
+  EXPECT_EQ(m1.size(), m2.size());
+  EXPECT_TRUE(std::equal(m2.begin(), m2.end(), m1.begin()));
+  // the order check falls back to plain inserts at the first unsorted key
+  std::vector<int> mixed{1, 2, 5, 5, 9, 3, 4, 12, 0, 9};
+  s21::set<int> m3(mixed.begin(), mixed.end());
+  std::set<int> m4(mixed.begin(), mixed.end());
+  EXPECT_EQ(m3.size(), m4.size());
+  EXPECT_TRUE(std::equal(m4.begin(), m4.end(), m3.begin()));
+  for (int i = 0; i < 2500; i += 2) m1.erase(m1.find(i));
+  m1.insert(-1);
+  EXPECT_EQ(m1.size(), 1251U);
+  EXPECT_EQ(*m1.begin(), -1);
+  EXPECT_EQ(*--m1.end(), 2499);
+}
+
+TEST(set_test, RangeConstructorTags) {
+  std::vector<int> keys{1, 1, 2, 3, 3, 3, 7};
+  s21::set<int> m1(s21::assume_sorted, keys.begin(), keys.end());
+  std::vector<int> unique{1, 2, 3, 7};
+  EXPECT_EQ(m1.size(), 4U);
+  EXPECT_TRUE(std::equal(unique.begin(), unique.end(), m1.begin()));
+  s21::set<int> m2(s21::assume_unique, unique.begin(), unique.end());
+  EXPECT_EQ(m2.size(), 4U);
+  EXPECT_TRUE(std::equal(unique.begin(), unique.end(), m2.begin()));
+  EXPECT_TRUE(m2.contains(7));
+  EXPECT_FALSE(m2.contains(4));
+}
+
+TEST(set_test, InsertRange) {
+  std::istringstream input("4 8 15 16 23 42");
+  s21::set<int> m1;
+  m1.insert(std::istream_iterator<int>(input), std::istream_iterator<int>());
+  EXPECT_EQ(m1.size(), 6U);
+  std::vector<int> more{42, 1, 16, 100};
+  m1.insert(more.begin(), more.end());
+  std::set<int> m2{1, 4, 8, 15, 16, 23, 42, 100};
+  EXPECT_EQ(m1.size(), m2.size());
+  EXPECT_TRUE(std::equal(m2.begin(), m2.end(), m1.begin()));
+}
+
+TEST(set_test, CustomCompare) {
+  std::vector<int> keys{9, 7, 7, 4, 1, 0};
+  s21::set<int, std::greater<int>> m1(keys.begin(), keys.end());
+  std::set<int, std::greater<int>> m2(keys.begin(), keys.end());
+  m1.insert(5);
+  m2.insert(5);
+  EXPECT_EQ(m1.size(), m2.size());
+  EXPECT_TRUE(std::equal(m2.begin(), m2.end(), m1.begin()));
+  EXPECT_TRUE(m1.contains(7));
+  EXPECT_TRUE(m1.find(3) == m1.end());
+  EXPECT_TRUE(m1.key_comp()(2, 1));
+  s21::set<int, std::greater<int>> m3(m1);
+  m3.erase(m3.find(9));
+  EXPECT_EQ(*m3.begin(), 7);
+}
+
+TEST(set_test, TransparentLookup) {
+  s21::set<std::string, std::less<>> m1{"pear", "apple", "plum"};
+  std::string_view view = "apple pie";
+  EXPECT_TRUE(m1.contains(view.substr(0, 5)));
+  EXPECT_FALSE(m1.contains(view));
+  EXPECT_EQ(*m1.find("plum"), "plum");
+  EXPECT_TRUE(m1.find(std::string_view("fig")) == m1.end());
+}
+
+TEST(set_test, HintedInsert) {
+  s21::set<int> m1;
+  std::set<int> m2;
+  for (int i = 0; i < 100; i += 2) {
+    m1.insert(m1.end(), i);
+    m2.insert(m2.end(), i);
+  }
+  EXPECT_EQ(*m1.insert(m1.find(10), 9), 9);
+  EXPECT_EQ(*m1.insert(m1.find(10), 11), 11);
+  EXPECT_EQ(*m1.insert(m1.begin(), -1), -1);
+  // a wrong hint only costs the usual descent
+  EXPECT_EQ(*m1.insert(m1.begin(), 55), 55);
+  EXPECT_TRUE(m1.insert(m1.end(), 20) == m1.find(20));
+  for (int key : {9, 11, -1, 55, 20}) m2.insert(key);
+  EXPECT_EQ(m1.size(), m2.size());
+  EXPECT_TRUE(std::equal(m2.begin(), m2.end(), m1.begin()));
+}
+
+TEST(set_test, HintedInsertNearlySorted) {
+  s21::set<int> m1;
+  std::set<int> m2;
+  auto hint = m1.end();
+  for (int i = 0; i < 2000; ++i) {
+    int key = i % 10 == 9 ? i - 5 : i;
+    hint = m1.insert(hint, key);
+    ++hint;
+    m2.insert(key);
+  }
+  EXPECT_EQ(m1.size(), m2.size());
+  EXPECT_TRUE(std::equal(m2.begin(), m2.end(), m1.begin()));
+}
+
+TEST(set_test, EmplaceHintAtBothEnds) {
+  s21::set<std::string> m1{"b", "d"};
+  m1.erase(m1.find("d"));
+  EXPECT_EQ(*m1.emplace_hint(m1.end(), 3, 'c'), "ccc");
+  m1.erase(m1.begin());
+  EXPECT_EQ(*m1.begin(), "ccc");
+  m1.emplace_hint(m1.begin(), "a");
+  m1.emplace_hint(m1.end(), "e");
+  std::vector<std::string> expected{"a", "ccc", "e"};
+  EXPECT_EQ(m1.size(), expected.size());
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), m1.begin()));
+  m1.clear();
+  EXPECT_TRUE(m1.begin() == m1.end());
+  m1.emplace_hint(m1.end(), "z");
+  EXPECT_EQ(*m1.begin(), "z");
+}
+
+TEST(set_test, ExtractAndInsertNode) {
+  s21::set<std::string> m1{"a", "b", "c"};
+  s21::set<std::string> m2{"x"};
+  auto handle = m1.extract("b");
+  EXPECT_FALSE(handle.empty());
+  EXPECT_EQ(m1.size(), 2U);
+  EXPECT_TRUE(m1.extract("q").empty());
+  handle.value() = "y";
+  auto result = m2.insert(std::move(handle));
+  EXPECT_TRUE(result.inserted);
+  EXPECT_TRUE(result.node.empty());
+  EXPECT_EQ(*result.position, "y");
+  handle = m1.extract(m1.begin());
+  handle.value() = "x";
+  result = m2.insert(std::move(handle));
+  EXPECT_FALSE(result.inserted);
+  EXPECT_EQ(result.node.value(), "x");
+  EXPECT_TRUE(result.position == m2.begin());
+  result.node.value() = "w";
+  EXPECT_EQ(*m2.insert(m2.begin(), std::move(result.node)), "w");
+  std::vector<std::string> expected{"w", "x", "y"};
+  EXPECT_EQ(m2.size(), expected.size());
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), m2.begin()));
+  EXPECT_FALSE(m2.insert(s21::set<std::string>::node_type()).inserted);
+  EXPECT_EQ(*m1.begin(), "c");
+}
+
+TEST(set_test, BoundsAndRange) {
+  s21::set<int> m1;
+  std::set<int> m2;
+  for (int i = 0; i < 200; i += 3) {
+    m1.insert(i);
+    m2.insert(i);
+  }
+  const s21::set<int>& m3 = m1;
+  for (int key = -2; key < 203; ++key) {
+    auto lower = m2.lower_bound(key);
+    auto upper = m2.upper_bound(key);
+    EXPECT_EQ(m1.lower_bound(key) == m1.end(), lower == m2.end());
+    EXPECT_EQ(m3.upper_bound(key) == m3.end(), upper == m2.end());
+    if (lower != m2.end()) {
+      EXPECT_EQ(*m1.lower_bound(key), *lower);
+    }
+    if (upper != m2.end()) {
+      EXPECT_EQ(*m3.upper_bound(key), *upper);
+    }
+    auto range = m1.equal_range(key);
+    EXPECT_EQ(range.first != range.second, m2.count(key) == 1);
+  }
+  std::vector<int> window;
+  for (int key : m3.range(10, 40)) window.push_back(key);
+  std::vector<int> expected(m2.lower_bound(10), m2.lower_bound(40));
+  EXPECT_EQ(window, expected);
+  EXPECT_TRUE(m1.range(40, 10).empty());
+  EXPECT_TRUE(m1.range(4, 5).empty());
+  EXPECT_FALSE(m1.range(190, 1000).empty());
+  EXPECT_TRUE(m1.range(190, 1000).end() == m1.end());
+  s21::set<std::string, std::less<>> m4{"apple", "banana", "cherry"};
+  EXPECT_EQ(*m4.lower_bound(std::string_view("b")), "banana");
+  EXPECT_EQ(*m4.upper_bound(std::string_view("banana")), "cherry");
+  auto fruits = m4.range(std::string_view("b"), std::string_view("d"));
+  EXPECT_EQ(*fruits.begin(), "banana");
+  EXPECT_TRUE(fruits.end() == m4.end());
+}
+
+TEST(set_test, StandardIterator) {
+  using Iterator = s21::set<int>::iterator;
+  static_assert(std::is_same_v<
+                std::iterator_traits<Iterator>::iterator_category,
+                std::bidirectional_iterator_tag>);
+  s21::set<int> one{5, 1, 4, 2, 3};
+  s21::set<int> two(one.begin(), one.end());
+  ASSERT_EQ(two.size(), 5);
+  ASSERT_EQ(std::distance(two.begin(), two.end()), 5);
+  ASSERT_EQ(*std::next(two.begin(), 2), 3);
+  ASSERT_EQ(*std::prev(two.end()), 5);
+  s21::set<int> three(std::next(one.begin()), std::prev(one.end()));
+  std::vector<int> values(three.begin(), three.end());
+  ASSERT_EQ(values, (std::vector<int>{2, 3, 4}));
+}
+
 // throw cause leaks on Mac
 
 // TEST(set_test, throw_test) {
 //   s21::set<int> m1 = {10, 3, 11, 15};
 //   auto it = m1.end();
 //   EXPECT_ANY_THROW(m1.erase(it));
-// }
\ No newline at end of file
+// }
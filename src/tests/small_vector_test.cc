@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+template <typename T>
+struct HeapCounter {
+  using value_type = T;
+  static inline int allocations = 0;
+  HeapCounter() = default;
+  template <typename U>
+  HeapCounter(const HeapCounter<U> &) {}
+  T *allocate(size_t n) {
+    ++allocations;
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T *p, size_t n) { std::allocator<T>().deallocate(p, n); }
+  bool operator==(const HeapCounter &) const { return true; }
+  bool operator!=(const HeapCounter &) const { return false; }
+};
+
+template <typename Vector>
+bool InsideObject(const Vector &v) {
+  auto begin = reinterpret_cast<const char *>(&v);
+  auto data = reinterpret_cast<const char *>(v.data());
+  return data >= begin && data < begin + sizeof(v);
+}
+
+TEST(SmallVectorTest, InlineStorage) {
+  HeapCounter<int>::allocations = 0;
+  s21::small_vector<int, 8, HeapCounter<int>> one;
+  ASSERT_EQ(one.capacity(), 8);
+  for (int i = 0; i < 8; ++i) one.push_back(i);
+  ASSERT_TRUE(one.is_inline());
+  ASSERT_TRUE(InsideObject(one));
+  ASSERT_EQ(HeapCounter<int>::allocations, 0);
+  ASSERT_EQ(one.reallocations(), 0);
+}
+
+TEST(SmallVectorTest, SpillToHeap) {
+  HeapCounter<int>::allocations = 0;
+  s21::small_vector<int, 4, HeapCounter<int>> one{1, 2, 3, 4};
+  one.push_back(5);
+  ASSERT_FALSE(one.is_inline());
+  ASSERT_EQ(HeapCounter<int>::allocations, 1);
+  for (int i = 0; i < 5; ++i) ASSERT_EQ(one[i], i + 1);
+  one.pop_back();
+  one.pop_back();
+  one.shrink_to_fit();
+  ASSERT_TRUE(one.is_inline());
+  ASSERT_EQ(one.size(), 3);
+  ASSERT_EQ(one.back(), 3);
+}
+
+TEST(SmallVectorTest, VectorInterface) {
+  s21::small_vector<std::string, 4> one{"b", "d"};
+  one.insert(one.begin(), "a");
+  one.emplace(++(++one.begin()), "c");
+  one.emplace_back(3, 'e');
+  std::vector<std::string> two{"a", "b", "c", "d", "eee"};
+  ASSERT_EQ(one.size(), two.size());
+  size_t i = 0;
+  for (auto it = one.begin(); it != one.end(); ++it, ++i) {
+    ASSERT_EQ(*it, two[i]);
+  }
+  one.erase(one.begin(), ++(++one.begin()));
+  ASSERT_EQ(one.front(), "c");
+  ASSERT_EQ(*one.data(), "c");
+}
+
+TEST(SmallVectorTest, CopyAndMoveInline) {
+  s21::small_vector<std::string, 4> one{"1", "2", "3"};
+  s21::small_vector<std::string, 4> two(one);
+  ASSERT_TRUE(two.is_inline());
+  ASSERT_NE(one.data(), two.data());
+  s21::small_vector<std::string, 4> three(std::move(one));
+  ASSERT_TRUE(three.is_inline());
+  ASSERT_EQ(three[2], "3");
+  ASSERT_TRUE(one.empty());
+  one = three;
+  ASSERT_EQ(one.size(), 3);
+  two = std::move(three);
+  ASSERT_EQ(two[0], "1");
+}
+
+TEST(SmallVectorTest, MoveHeapAdoptsStorage) {
+  s21::small_vector<int, 2> one{1, 2, 3, 4, 5};
+  ASSERT_FALSE(one.is_inline());
+  auto data = one.data();
+  s21::small_vector<int, 2> two(std::move(one));
+  ASSERT_EQ(two.data(), data);
+  ASSERT_EQ(two.size(), 5);
+  s21::small_vector<int, 2> three{7};
+  three = std::move(two);
+  ASSERT_EQ(three.data(), data);
+  ASSERT_EQ(three[4], 5);
+  one.push_back(10);
+  ASSERT_TRUE(one.is_inline());
+}
+
+TEST(SmallVectorTest, Swap) {
+  s21::small_vector<std::string, 2> one{"a"};
+  s21::small_vector<std::string, 2> two{"x", "y", "z"};
+  one.swap(two);
+  ASSERT_EQ(one.size(), 3);
+  ASSERT_EQ(two.size(), 1);
+  ASSERT_EQ(one[2], "z");
+  ASSERT_EQ(two[0], "a");
+  ASSERT_TRUE(two.is_inline());
+  s21::small_vector<std::string, 2> three{"1", "2", "3", "4"};
+  one.swap(three);
+  ASSERT_EQ(one[3], "4");
+  ASSERT_EQ(three[0], "x");
+}
+
+TEST(SmallVectorTest, CountConstructor) {
+  s21::small_vector<std::string, 4> one(6);
+  ASSERT_EQ(one.size(), 6);
+  ASSERT_FALSE(one.is_inline());
+  s21::small_vector<int, 4> two(3);
+  ASSERT_TRUE(two.is_inline());
+  ASSERT_EQ(two[2], 0);
+  ASSERT_EQ(two.inline_capacity(), 4);
+}
+
+TEST(SmallVectorTest, NotAVector) {
+  using Small = s21::small_vector<std::string, 4>;
+  static_assert(!std::is_convertible_v<Small &, Small::vector_type &>);
+  static_assert(!std::is_constructible_v<Small::vector_type, Small &&>);
+  s21::vector<std::string> heap;
+  {
+    Small one{"a", "b"};
+    heap.insert(heap.end(), one.begin(), one.end());
+  }
+  ASSERT_EQ(heap.size(), 2);
+  ASSERT_EQ(heap[1], "b");
+}
+
+TEST(SmallVectorTest, NothrowMove) {
+  using inner = s21::small_vector<int, 1>;
+  static_assert(std::is_nothrow_move_constructible_v<inner>);
+  static_assert(std::is_nothrow_move_assignable_v<inner>);
+  static_assert(
+      std::is_nothrow_move_constructible_v<s21::small_vector<std::string, 2>>);
+  // a vector of them moves the heap storage over as it grows
+  s21::vector<inner> outer;
+  outer.emplace_back(inner{1, 2, 3});
+  const int *data = outer[0].data();
+  for (int i = 0; i < 100; ++i) outer.emplace_back();
+  ASSERT_GT(outer.reallocations(), 0);
+  ASSERT_EQ(outer[0].data(), data);
+  ASSERT_EQ(outer[0][2], 3);
+}
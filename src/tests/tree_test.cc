@@ -0,0 +1,250 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "../s21_containers.h"
+
+namespace {
+// TestNode keeps subtree counts and holds copies_ equal keys, so Check() also
+// verifies that every algorithm maintains the counts of weighted nodes
+struct TestNode : s21::tree::NodeCount<true>, s21::tree::NodeCopies<true> {
+  int key = 0;
+  TestNode *top_ = nullptr;
+  TestNode *left_ = nullptr;
+  TestNode *right_ = nullptr;
+  s21::NodeColor color_ = s21::NodeColor::kRed;
+};
+
+class Tree {
+ public:
+  ~Tree() {
+    for (TestNode *node : nodes_) delete node;
+  }
+
+  TestNode *Insert(int key, std::size_t copies = 1) {
+    TestNode *parent = &header_;
+    bool left = true;
+    for (TestNode *current = header_.left_; current;) {
+      parent = current;
+      left = key < current->key;
+      current = left ? current->left_ : current->right_;
+    }
+    TestNode *node = new TestNode;
+    node->key = key;
+    node->copies_ = copies;
+    nodes_.push_back(node);
+    s21::tree::InsertNode(node, parent, left, &header_);
+    return node;
+  }
+
+  void Erase(TestNode *node) {
+    s21::tree::EraseNode(node, &header_);
+    nodes_.erase(std::find(nodes_.begin(), nodes_.end(), node));
+    delete node;
+  }
+
+  // Check() verifies links, order, colors and subtree counts and returns the
+  // black height
+  int Check() const {
+    EXPECT_EQ(header_.right_, nullptr);
+    if (header_.left_) {
+      EXPECT_EQ(header_.left_->top_, &header_);
+      EXPECT_TRUE(s21::tree::IsBlack(header_.left_));
+    }
+    std::size_t count = 0;
+    int height = CheckSubtree(header_.left_, &count);
+    std::size_t elements = 0;
+    for (const TestNode *node : nodes_) elements += node->copies_;
+    EXPECT_EQ(count, elements);
+    return height;
+  }
+
+  int Height(const TestNode *node) const {
+    return node ? 1 + std::max(Height(node->left_), Height(node->right_)) : 0;
+  }
+
+  TestNode header_;
+  std::vector<TestNode *> nodes_;
+
+ private:
+  int CheckSubtree(const TestNode *node, std::size_t *count) const {
+    if (!node) return 1;
+    std::size_t before = *count;
+    *count += node->copies_;
+    if (!s21::tree::IsBlack(node)) {
+      EXPECT_TRUE(s21::tree::IsBlack(node->left_));
+      EXPECT_TRUE(s21::tree::IsBlack(node->right_));
+    }
+    if (node->left_) {
+      EXPECT_EQ(node->left_->top_, node);
+      EXPECT_LE(node->left_->key, node->key);
+    }
+    if (node->right_) {
+      EXPECT_EQ(node->right_->top_, node);
+      EXPECT_GE(node->right_->key, node->key);
+    }
+    int left = CheckSubtree(node->left_, count);
+    int right = CheckSubtree(node->right_, count);
+    EXPECT_EQ(left, right);
+    EXPECT_EQ(node->count_, *count - before);
+    return left + (s21::tree::IsBlack(node) ? 1 : 0);
+  }
+};
+
+unsigned Next(unsigned *seed) {
+  *seed = *seed * 1103515245u + 12345u;
+  return *seed >> 8;
+}
+}  // namespace
+
+TEST(TreeTest, InsertAscending) {
+  Tree tree;
+  for (int i = 0; i < 1024; ++i) {
+    tree.Insert(i);
+    if (i % 97 == 0) tree.Check();
+  }
+  tree.Check();
+  ASSERT_LE(tree.Height(tree.header_.left_), 2 * std::log2(1025.0));
+}
+
+TEST(TreeTest, InsertDescendingWithDuplicates) {
+  Tree tree;
+  for (int i = 500; i > 0; --i) {
+    tree.Insert(i / 3);
+  }
+  tree.Check();
+  ASSERT_LE(tree.Height(tree.header_.left_), 2 * std::log2(501.0));
+}
+
+TEST(TreeTest, RandomInsertErase) {
+  Tree tree;
+  unsigned seed = 7;
+  for (int round = 0; round < 2000; ++round) {
+    if (tree.nodes_.empty() || Next(&seed) % 3 != 0) {
+      tree.Insert(static_cast<int>(Next(&seed) % 300));
+    } else {
+      tree.Erase(tree.nodes_[Next(&seed) % tree.nodes_.size()]);
+    }
+    if (round % 50 == 0) tree.Check();
+  }
+  tree.Check();
+  while (!tree.nodes_.empty()) {
+    tree.Erase(tree.nodes_[Next(&seed) % tree.nodes_.size()]);
+    tree.Check();
+  }
+  ASSERT_EQ(tree.header_.left_, nullptr);
+}
+
+TEST(TreeTest, EraseRelinksNodes) {
+  Tree tree;
+  std::vector<TestNode *> nodes;
+  for (int i = 0; i < 64; ++i) nodes.push_back(tree.Insert(i));
+  // the root has two children, so its successor has to be moved into place
+  TestNode *root = tree.header_.left_;
+  int root_key = root->key;
+  tree.Erase(root);
+  tree.Check();
+  for (TestNode *node : nodes) {
+    if (node == root) continue;
+    ASSERT_NE(node->key, root_key);
+    ASSERT_TRUE(node->top_ == &tree.header_ || node->top_->left_ == node ||
+                node->top_->right_ == node);
+  }
+}
+
+TEST(TreeTest, CloneKeepsShapeAndColors) {
+  Tree tree;
+  unsigned seed = 11;
+  for (int i = 0; i < 700; ++i) {
+    tree.Insert(static_cast<int>(Next(&seed) % 500));
+  }
+  Tree copy;
+  s21::tree::Clone(&tree.header_, &copy.header_, [&copy](const TestNode *from) {
+    TestNode *node = new TestNode;
+    node->key = from->key;
+    copy.nodes_.push_back(node);
+    return node;
+  });
+  copy.Check();
+  ASSERT_EQ(copy.nodes_.size(), tree.nodes_.size());
+  // both trees are walked in the same preorder, node by node
+  const TestNode *one = tree.header_.left_;
+  const TestNode *two = copy.header_.left_;
+  std::vector<std::pair<const TestNode *, const TestNode *>> pending;
+  while (one || !pending.empty()) {
+    if (!one) {
+      one = pending.back().first;
+      two = pending.back().second;
+      pending.pop_back();
+    }
+    ASSERT_NE(one, two);
+    ASSERT_EQ(one->key, two->key);
+    ASSERT_EQ(one->color_, two->color_);
+    ASSERT_EQ(!one->right_, !two->right_);
+    ASSERT_EQ(!one->left_, !two->left_);
+    if (one->right_) pending.emplace_back(one->right_, two->right_);
+    one = one->left_;
+    two = two->left_;
+  }
+}
+
+TEST(TreeTest, BuildSortedIsBalanced) {
+  for (int size = 0; size < 130; ++size) {
+    Tree tree;
+    TestNode *list = nullptr;
+    for (int i = size; i > 0; --i) {
+      TestNode *node = new TestNode;
+      node->key = i;
+      node->right_ = list;
+      list = node;
+      tree.nodes_.push_back(node);
+    }
+    s21::tree::BuildSorted(list, tree.nodes_.size(), &tree.header_);
+    tree.Check();
+    ASSERT_EQ(tree.Height(tree.header_.left_),
+              static_cast<int>(std::ceil(std::log2(size + 1.0))));
+    // the built tree has to stay valid under further changes
+    for (int i = 0; i < size; i += 3) tree.Insert(i);
+    tree.Check();
+    while (tree.nodes_.size() > 1) tree.Erase(tree.nodes_[0]);
+    tree.Check();
+  }
+}
+
+TEST(TreeTest, WeightedNodes) {
+  Tree tree;
+  unsigned seed = 13;
+  for (int round = 0; round < 1500; ++round) {
+    if (tree.nodes_.empty() || Next(&seed) % 3 != 0) {
+      tree.Insert(static_cast<int>(Next(&seed) % 400), 1 + Next(&seed) % 5);
+    } else {
+      tree.Erase(tree.nodes_[Next(&seed) % tree.nodes_.size()]);
+    }
+    if (round % 50 == 0) tree.Check();
+  }
+  tree.Check();
+  // Select() finds every element and its index within the node
+  std::vector<std::pair<const TestNode *, std::size_t>> elements;
+  std::vector<const TestNode *> pending;
+  for (const TestNode *node = tree.header_.left_; node || !pending.empty();) {
+    if (node) {
+      pending.push_back(node);
+      node = node->left_;
+    } else {
+      node = pending.back();
+      pending.pop_back();
+      for (std::size_t i = 0; i < node->copies_; ++i) {
+        elements.emplace_back(node, i);
+      }
+      node = node->right_;
+    }
+  }
+  ASSERT_EQ(elements.size(), tree.header_.left_->count_);
+  for (std::size_t k = 0; k < elements.size(); ++k) {
+    std::size_t index = k;
+    ASSERT_EQ(s21::tree::Select(tree.header_.left_, index), elements[k].first);
+    ASSERT_EQ(index, elements[k].second);
+  }
+}
@@ -1,6 +1,12 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <array>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <sstream>
+#include <stdexcept>
 #include <vector>
 
 #include "../s21_containers.h"
@@ -294,6 +300,666 @@ TEST(VectorTest, 37) {
   }
 }
 
+TEST(VectorTest, 38) {
+  s21::vector<int> one;
+  for (int i = 0; i < 100000; ++i) one.push_back(i);
+  ASSERT_EQ(one.size(), 100000);
+  ASSERT_LE(one.reallocations(), 18);
+  for (int i = 0; i < 100000; ++i) ASSERT_EQ(one[i], i);
+}
+
+TEST(VectorTest, 39) {
+  s21::vector<int, std::allocator<int>, s21::GeometricGrowth<3, 2>> one;
+  s21::vector<int> two;
+  for (int i = 0; i < 1000; ++i) {
+    one.push_back(i);
+    two.push_back(i);
+  }
+  ASSERT_GT(one.reallocations(), two.reallocations());
+  ASSERT_LE(one.capacity(), 1000 * 3 / 2);
+  for (size_t i = 0; i < one.size(); ++i) ASSERT_EQ(one[i], two[i]);
+}
+
+TEST(VectorTest, 40) {
+  ASSERT_EQ((s21::GeometricGrowth<3, 2>::NextCapacity(0, 1)), 1);
+  ASSERT_EQ((s21::GeometricGrowth<3, 2>::NextCapacity(1, 2)), 2);
+  ASSERT_EQ((s21::GeometricGrowth<3, 2>::NextCapacity(10, 11)), 15);
+  ASSERT_EQ((s21::GeometricGrowth<2, 1>::NextCapacity(10, 11)), 20);
+  ASSERT_EQ((s21::GeometricGrowth<2, 1>::NextCapacity(10, 50)), 50);
+}
+
+TEST(VectorTest, 41) {
+  s21::vector<std::string> one{"1", "2", "3"};
+  s21::vector<std::string> two(one);
+  ASSERT_EQ(two.capacity(), two.size());
+  two.push_back("4");
+  ASSERT_EQ(two.reallocations(), 1);
+  ASSERT_EQ(two.back(), "4");
+  ASSERT_EQ(one.size(), 3);
+}
+
+struct MoveCounter {
+  static inline int copies = 0;
+  static inline int moves = 0;
+  static inline int alive = 0;
+  int value = 0;
+  MoveCounter(int v = 0) : value(v) { ++alive; }
+  MoveCounter(const MoveCounter &other) : value(other.value) {
+    ++copies;
+    ++alive;
+  }
+  MoveCounter(MoveCounter &&other) noexcept : value(other.value) {
+    ++moves;
+    ++alive;
+  }
+  MoveCounter &operator=(const MoveCounter &other) {
+    value = other.value;
+    ++copies;
+    return *this;
+  }
+  MoveCounter &operator=(MoveCounter &&other) noexcept {
+    value = other.value;
+    ++moves;
+    return *this;
+  }
+  ~MoveCounter() { --alive; }
+  static void Reset() { copies = moves = 0; }
+};
+
+struct ThrowingMove {
+  static inline int copies = 0;
+  ThrowingMove() = default;
+  ThrowingMove(const ThrowingMove &) { ++copies; }
+  ThrowingMove(ThrowingMove &&) {}
+};
+
+struct Relocatable {
+  std::unique_ptr<int> value;
+};
+
+template <>
+struct s21::is_trivially_relocatable<Relocatable> : std::true_type {};
+
+TEST(VectorTest, 42) {
+  {
+    s21::vector<MoveCounter> one{1, 2, 3};
+    MoveCounter::Reset();
+    one.reserve(100);
+    ASSERT_EQ(MoveCounter::copies, 0);
+    ASSERT_EQ(MoveCounter::moves, 3);
+    ASSERT_EQ(MoveCounter::alive, 3);
+    one.shrink_to_fit();
+    ASSERT_EQ(MoveCounter::copies, 0);
+    ASSERT_EQ(MoveCounter::alive, 3);
+    ASSERT_EQ(one[2].value, 3);
+  }
+  ASSERT_EQ(MoveCounter::alive, 0);
+}
+
+TEST(VectorTest, 43) {
+  s21::vector<ThrowingMove> one;
+  one.push_back(ThrowingMove());
+  one.push_back(ThrowingMove());
+  ThrowingMove::copies = 0;
+  one.reserve(10);
+  ASSERT_EQ(ThrowingMove::copies, 2);
+}
+
+TEST(VectorTest, 44) {
+  s21::vector<Relocatable> one;
+  one.push_back(Relocatable{std::make_unique<int>(1)});
+  one.push_back(Relocatable{std::make_unique<int>(2)});
+  int *first = one[0].value.get();
+  one.reserve(64);
+  ASSERT_EQ(one[0].value.get(), first);
+  ASSERT_EQ(*one[1].value, 2);
+}
+
+TEST(VectorTest, 45) {
+  s21::vector<std::string> one;
+  for (int i = 0; i < 1000; ++i) one.push_back(std::to_string(i));
+  one.reserve(5000);
+  one.shrink_to_fit();
+  ASSERT_EQ(one.capacity(), 1000);
+  for (int i = 0; i < 1000; ++i) ASSERT_EQ(one[i], std::to_string(i));
+}
+
+TEST(VectorTest, 46) {
+  s21::vector<std::string> one{"a", "b", "c", "d", "e"};
+  std::vector<std::string> two{"a", "b", "c", "d", "e"};
+  one.reserve(10);
+  auto data = one.data();
+  auto it = one.begin();
+  ++it;
+  ++it;
+  one.insert(it, "x");
+  two.insert(two.begin() + 2, "x");
+  it = one.begin();
+  one.insert(it, one[4]);
+  two.insert(two.begin(), two[4]);
+  one.erase(++one.begin());
+  two.erase(two.begin() + 1);
+  ASSERT_EQ(one.data(), data);
+  ASSERT_EQ(one.reallocations(), 1);
+  ASSERT_EQ(one.size(), two.size());
+  for (size_t i = 0; i < two.size(); ++i) ASSERT_EQ(one[i], two[i]);
+}
+
+TEST(VectorTest, 47) {
+  s21::vector<std::string> one{"a", "b", "c", "d", "e", "f"};
+  std::vector<std::string> two{"a", "b", "c", "d", "e", "f"};
+  auto first = ++one.begin();
+  auto last = first;
+  ++last;
+  ++last;
+  ++last;
+  auto res = one.erase(first, last);
+  two.erase(two.begin() + 1, two.begin() + 4);
+  ASSERT_EQ(*res, "e");
+  ASSERT_EQ(one.size(), two.size());
+  for (size_t i = 0; i < two.size(); ++i) ASSERT_EQ(one[i], two[i]);
+}
+
+TEST(VectorTest, 48) {
+  std::vector<std::string> src{"x", "y", "z", "w"};
+  for (size_t pos = 0; pos <= 3; ++pos) {
+    for (size_t cap : {3, 10}) {
+      s21::vector<std::string> one{"a", "b", "c"};
+      std::vector<std::string> two{"a", "b", "c"};
+      one.reserve(cap);
+      auto it = one.begin();
+      for (size_t i = 0; i < pos; ++i) ++it;
+      auto res = one.insert(it, src.begin(), src.end());
+      two.insert(two.begin() + pos, src.begin(), src.end());
+      ASSERT_EQ(*res, "x");
+      ASSERT_EQ(one.size(), two.size());
+      for (size_t i = 0; i < two.size(); ++i) ASSERT_EQ(one[i], two[i]);
+    }
+  }
+}
+
+TEST(VectorTest, 49) {
+  s21::vector<int> one{1, 2, 3, 4, 5, 6, 7, 8};
+  int src[] = {10, 20};
+  one.reserve(16);
+  one.insert(++one.begin(), src, src + 2);
+  one.erase(one.begin(), ++one.begin());
+  s21::vector<int> test{10, 20, 2, 3, 4, 5, 6, 7, 8};
+  ASSERT_EQ(one.size(), test.size());
+  for (size_t i = 0; i < test.size(); ++i) ASSERT_EQ(one[i], test[i]);
+  one.insert(one.end(), 9);
+  ASSERT_EQ(one.back(), 9);
+  ASSERT_EQ(one.reallocations(), 1);
+}
+
+TEST(VectorTest, 50) {
+  {
+    s21::vector<MoveCounter> one{1, 2, 3, 4};
+    one.reserve(8);
+    one.erase(one.begin());
+    one.insert(one.begin(), MoveCounter(0));
+    ASSERT_EQ(MoveCounter::alive, 4);
+    ASSERT_EQ(one[0].value, 0);
+    ASSERT_EQ(one[3].value, 4);
+  }
+  ASSERT_EQ(MoveCounter::alive, 0);
+}
+
+struct Record {
+  Record(int id, std::string name, std::unique_ptr<int> payload)
+      : id(id), name(std::move(name)), payload(std::move(payload)) {}
+  int id;
+  std::string name;
+  std::unique_ptr<int> payload;
+};
+
+TEST(VectorTest, 51) {
+  s21::vector<Record> one;
+  for (int i = 0; i < 20; ++i) {
+    auto &rec =
+        one.emplace_back(i, std::to_string(i), std::make_unique<int>(i));
+    ASSERT_EQ(rec.id, i);
+  }
+  auto it = one.emplace(one.begin(), -1, "head", nullptr);
+  ASSERT_EQ((*it).name, "head");
+  ASSERT_EQ(one.size(), 21);
+  for (int i = 0; i < 20; ++i) {
+    ASSERT_EQ(one[i + 1].name, std::to_string(i));
+    ASSERT_EQ(*one[i + 1].payload, i);
+  }
+}
+
+TEST(VectorTest, 52) {
+  {
+    s21::vector<MoveCounter> one;
+    one.reserve(4);
+    MoveCounter::Reset();
+    one.emplace_back(1);
+    one.emplace_back(2);
+    one.push_back(MoveCounter(3));
+    ASSERT_EQ(MoveCounter::copies, 0);
+    ASSERT_EQ(MoveCounter::moves, 1);
+    one.emplace(one.begin(), 0);
+    ASSERT_EQ(MoveCounter::copies, 0);
+    ASSERT_EQ(one[0].value, 0);
+    ASSERT_EQ(one[3].value, 3);
+  }
+  ASSERT_EQ(MoveCounter::alive, 0);
+}
+
+TEST(VectorTest, 53) {
+  s21::vector<std::string> one{"first", "second"};
+  ASSERT_EQ(one.size(), one.capacity());
+  one.emplace_back(one[0]);
+  one.emplace(one.begin(), one[2]);
+  one.insert(one.begin(), one.back());
+  s21::vector<std::string> test{"first", "first", "first", "second",
+                                "first"};
+  ASSERT_EQ(one.size(), test.size());
+  for (size_t i = 0; i < test.size(); ++i) ASSERT_EQ(one[i], test[i]);
+}
+
+TEST(VectorTest, 54) {
+  s21::vector<std::string> one;
+  one.emplace_back(3, 'a');
+  one.emplace(one.begin(), "bb");
+  std::string moved(100, 'c');
+  one.push_back(std::move(moved));
+  ASSERT_EQ(one[0], "bb");
+  ASSERT_EQ(one[1], "aaa");
+  ASSERT_EQ(one[2], std::string(100, 'c'));
+}
+
+template <typename T>
+struct CountingAllocator {
+  using value_type = T;
+  static inline int allocations = 0;
+  static inline int deallocations = 0;
+  CountingAllocator() = default;
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U> &) {}
+  T *allocate(size_t n) {
+    ++allocations;
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T *p, size_t n) {
+    ++deallocations;
+    std::allocator<T>().deallocate(p, n);
+  }
+  bool operator==(const CountingAllocator &) const { return true; }
+  bool operator!=(const CountingAllocator &) const { return false; }
+};
+
+TEST(VectorTest, 55) {
+  {
+    s21::vector<std::string, CountingAllocator<std::string>> one{"a", "b"};
+    auto two = one;
+    two.push_back("c");
+    one = two;
+    one = std::move(two);
+    ASSERT_EQ(one.size(), 3);
+    ASSERT_EQ(one[2], "c");
+  }
+  ASSERT_GT(CountingAllocator<std::string>::allocations, 0);
+  ASSERT_EQ(CountingAllocator<std::string>::allocations,
+            CountingAllocator<std::string>::deallocations);
+}
+
+TEST(VectorTest, 56) {
+  alignas(std::max_align_t) char buffer[4096];
+  std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer),
+                                            std::pmr::null_memory_resource());
+  s21::pmr::vector<int> one(&arena);
+  for (int i = 0; i < 200; ++i) one.push_back(i);
+  ASSERT_GE(reinterpret_cast<char *>(one.data()), buffer);
+  ASSERT_LT(reinterpret_cast<char *>(one.data()), buffer + sizeof(buffer));
+  ASSERT_EQ(one.get_allocator().resource(), &arena);
+  for (int i = 0; i < 200; ++i) ASSERT_EQ(one[i], i);
+}
+
+TEST(VectorTest, 57) {
+  std::pmr::monotonic_buffer_resource arena;
+  s21::pmr::vector<std::pmr::string> one(&arena);
+  one.emplace_back("a string long enough to need its own heap buffer");
+  one.push_back(std::pmr::string("short"));
+  ASSERT_EQ(one[0].get_allocator().resource(), &arena);
+  ASSERT_EQ(one[1].get_allocator().resource(), &arena);
+}
+
+TEST(VectorTest, 58) {
+  std::pmr::monotonic_buffer_resource first_arena;
+  std::pmr::monotonic_buffer_resource second_arena;
+  s21::pmr::vector<int> one({1, 2, 3}, &first_arena);
+  s21::pmr::vector<int> two(&second_arena);
+  two = std::move(one);
+  ASSERT_EQ(two.get_allocator().resource(), &second_arena);
+  ASSERT_EQ(two.size(), 3);
+  ASSERT_EQ(two[2], 3);
+  s21::pmr::vector<int> three(two);
+  ASSERT_EQ(three.get_allocator().resource(),
+            std::pmr::get_default_resource());
+  s21::pmr::vector<int> four(std::move(three));
+  ASSERT_EQ(four.size(), 3);
+  ASSERT_EQ(three.size(), 0);
+}
+
+TEST(VectorTest, 59) {
+  s21::vector<std::string> one(3);
+  ASSERT_EQ(one.size(), 3);
+  for (size_t i = 0; i < one.size(); ++i) ASSERT_TRUE(one[i].empty());
+}
+
+TEST(VectorTest, 60) {
+  s21::vector<int> one{5, 3, 9, 1, 7};
+  std::sort(one.begin(), one.end());
+  std::vector<int> two{1, 3, 5, 7, 9};
+  ASSERT_TRUE(std::equal(one.begin(), one.end(), two.begin()));
+  auto it = std::lower_bound(one.begin(), one.end(), 6);
+  ASSERT_EQ(it - one.begin(), 3);
+  ASSERT_EQ(*it, 7);
+  ASSERT_EQ(std::distance(one.begin(), one.end()), 5);
+}
+
+TEST(VectorTest, 61) {
+  s21::vector<std::string> one{"a", "b", "c", "d"};
+  auto it = one.begin() + 3;
+  ASSERT_EQ(*it, "d");
+  ASSERT_EQ(it[-2], "b");
+  it -= 3;
+  ASSERT_EQ(it->size(), 1);
+  it += 2;
+  ASSERT_EQ(*(it - 1), "b");
+  ASSERT_EQ(*(1 + it), "d");
+  ASSERT_TRUE(one.begin() < it);
+  ASSERT_TRUE(it <= it);
+  ASSERT_TRUE(one.end() > it);
+  ASSERT_TRUE(one.end() >= one.begin());
+}
+
+TEST(VectorTest, 62) {
+  const s21::vector<int> one{1, 2, 3};
+  s21::vector<int> two{1, 2, 3};
+  s21::vector<int>::const_iterator it = two.begin();
+  ASSERT_TRUE(it == two.begin());
+  ASSERT_TRUE(two.end() != it);
+  ASSERT_EQ(two.end() - it, 3);
+  auto jt = one.begin();
+  ++jt;
+  ASSERT_EQ(one.end() - jt, 2);
+  static_assert(std::is_same_v<std::iterator_traits<decltype(jt)>::reference,
+                               const int &>);
+  static_assert(
+      std::is_same_v<
+          std::iterator_traits<s21::vector<int>::iterator>::iterator_category,
+          std::random_access_iterator_tag>);
+  s21::vector<int> three(3);
+  std::copy(one.begin(), one.end(), three.begin());
+  ASSERT_EQ(three[2], 3);
+}
+
+TEST(VectorTest, 63) {
+  s21::vector<bool> one{true, false, true};
+  std::vector<bool> two{true, false, true};
+  for (int i = 0; i < 200; ++i) {
+    one.push_back(i % 3 == 0);
+    two.push_back(i % 3 == 0);
+  }
+  ASSERT_EQ(one.size(), two.size());
+  ASSERT_LE(one.capacity() / 8, one.size());
+  for (size_t i = 0; i < one.size(); ++i) ASSERT_EQ(one[i], two[i]);
+  one[1] = true;
+  one.at(0).flip();
+  ASSERT_TRUE(one[1]);
+  ASSERT_FALSE(one.front());
+  ASSERT_FALSE(one.back());
+  one.pop_back();
+  ASSERT_EQ(one.size(), 202);
+  EXPECT_THROW(one.at(202), std::out_of_range);
+  const s21::vector<bool> three(one);
+  ASSERT_EQ(static_cast<size_t>(std::count(three.begin(), three.end(), true)),
+            three.count());
+}
+
+TEST(VectorTest, 64) {
+  s21::vector<bool> one(130);
+  ASSERT_EQ(one.count(), 0);
+  ASSERT_EQ(one.find_first(), s21::vector<bool>::npos);
+  one[5] = one[64] = one[129] = true;
+  ASSERT_EQ(one.count(), 3);
+  ASSERT_EQ(one.find_first(), 5);
+  ASSERT_EQ(one.find_next(5), 64);
+  ASSERT_EQ(one.find_next(64), 129);
+  ASSERT_EQ(one.find_next(129), s21::vector<bool>::npos);
+  one.flip();
+  ASSERT_EQ(one.count(), 127);
+  ASSERT_EQ(one.find_first(), 0);
+  s21::vector<bool> two(130, true);
+  ASSERT_EQ(two.count(), 130);
+}
+
+TEST(VectorTest, 65) {
+  s21::vector<bool> one(100);
+  s21::vector<bool> two(100);
+  for (size_t i = 0; i < 100; i += 2) one[i] = true;
+  for (size_t i = 0; i < 100; i += 3) two[i] = true;
+  s21::vector<bool> both(one);
+  both &= two;
+  ASSERT_EQ(both.count(), 17);
+  s21::vector<bool> any(one);
+  any |= two;
+  ASSERT_EQ(any.count(), 67);
+  s21::vector<bool> odd(one);
+  odd ^= two;
+  ASSERT_EQ(odd.count(), 50);
+  for (size_t i = 0; i < 100; ++i) {
+    ASSERT_EQ(both[i], i % 6 == 0);
+    ASSERT_EQ(odd[i], (i % 2 == 0) != (i % 3 == 0));
+  }
+  s21::vector<bool> three(99);
+  EXPECT_THROW(one &= three, std::invalid_argument);
+}
+
+TEST(VectorTest, 66) {
+  s21::vector<bool> one;
+  std::vector<bool> two;
+  for (int i = 0; i < 150; ++i) {
+    one.push_back(i % 5 == 1);
+    two.push_back(i % 5 == 1);
+  }
+  for (size_t pos : {0, 63, 64, 100, 152}) {
+    auto it = one.insert(one.begin() + pos, true);
+    two.insert(two.begin() + pos, true);
+    ASSERT_EQ(it - one.begin(), static_cast<long>(pos));
+  }
+  for (size_t pos : {0, 62, 64, 127, 150}) {
+    one.erase(one.begin() + pos);
+    two.erase(two.begin() + pos);
+  }
+  one.erase(one.begin() + 10, one.begin() + 80);
+  two.erase(two.begin() + 10, two.begin() + 80);
+  ASSERT_EQ(one.size(), two.size());
+  for (size_t i = 0; i < one.size(); ++i) ASSERT_EQ(one[i], two[i]);
+  ASSERT_EQ(one.count(),
+            static_cast<size_t>(std::count(two.begin(), two.end(), true)));
+  EXPECT_THROW(one.erase(one.end()), std::logic_error);
+}
+
+TEST(VectorTest, 67) {
+  s21::vector<bool> one{true, true, false};
+  s21::vector<bool> two(std::move(one));
+  ASSERT_EQ(one.size(), 0);
+  ASSERT_EQ(two.size(), 3);
+  one = std::move(two);
+  ASSERT_EQ(one.count(), 2);
+  one.swap(two);
+  ASSERT_EQ(two.size(), 3);
+  swap(two[0], two[2]);
+  ASSERT_FALSE(two[0]);
+  ASSERT_TRUE(two[2]);
+  two.clear();
+  ASSERT_TRUE(two.empty());
+  std::pmr::monotonic_buffer_resource arena;
+  s21::pmr::vector<bool> three(&arena);
+  for (int i = 0; i < 1000; ++i) three.push_back(i & 1);
+  ASSERT_EQ(three.get_allocator().resource(), &arena);
+  ASSERT_EQ(three.count(), 500);
+}
+
+struct ThrowingCopy {
+  static inline int copies_left = 0;
+  static inline int alive = 0;
+  int value = 0;
+  ThrowingCopy(int v = 0) : value(v) { ++alive; }
+  ThrowingCopy(const ThrowingCopy &other) : value(other.value) {
+    if (copies_left-- == 0) throw std::runtime_error("copy failed");
+    ++alive;
+  }
+  ThrowingCopy(ThrowingCopy &&other) : value(other.value) { ++alive; }
+  ThrowingCopy &operator=(const ThrowingCopy &) = default;
+  ThrowingCopy &operator=(ThrowingCopy &&) = default;
+  ~ThrowingCopy() { --alive; }
+};
+
+TEST(VectorTest, 68) {
+  {
+    s21::vector<ThrowingCopy> one;
+    one.reserve(4);
+    for (int i = 0; i < 4; ++i) one.emplace_back(i);
+    ThrowingCopy::copies_left = 2;
+    EXPECT_THROW(one.reserve(100), std::runtime_error);
+    ASSERT_EQ(one.capacity(), 4);
+    ASSERT_EQ(ThrowingCopy::alive, 4);
+    for (int i = 0; i < 4; ++i) ASSERT_EQ(one[i].value, i);
+    one.pop_back();
+    ThrowingCopy::copies_left = 0;
+    EXPECT_THROW(one.shrink_to_fit(), std::runtime_error);
+    ASSERT_EQ(one.capacity(), 4);
+    ASSERT_EQ(ThrowingCopy::alive, 3);
+    ThrowingCopy::copies_left = 3;
+    one.shrink_to_fit();
+    ASSERT_EQ(one.capacity(), 3);
+    ASSERT_EQ(one[2].value, 2);
+  }
+  ASSERT_EQ(ThrowingCopy::alive, 0);
+}
+
+TEST(VectorTest, 69) {
+  std::istringstream words("a b c");
+  s21::vector<std::string> one{"x", "y"};
+  auto it =
+      one.insert(one.begin() + 1, std::istream_iterator<std::string>(words),
+                 std::istream_iterator<std::string>());
+  ASSERT_EQ(it - one.begin(), 1);
+  std::vector<std::string> two{"x", "a", "b", "c", "y"};
+  ASSERT_TRUE(std::equal(one.begin(), one.end(), two.begin(), two.end()));
+  std::istringstream none("");
+  it = one.insert(one.end(), std::istream_iterator<std::string>(none),
+                  std::istream_iterator<std::string>());
+  ASSERT_EQ(it, one.end());
+  ASSERT_EQ(one.size(), 5);
+}
+
+TEST(VectorTest, 70) {
+  {
+    ThrowingCopy::copies_left = 100;
+    std::vector<ThrowingCopy> src{7, 8, 9};
+    s21::vector<ThrowingCopy> one;
+    for (int i = 0; i < 4; ++i) one.emplace_back(i);
+    one.shrink_to_fit();
+    // the tail copy of a reallocating insert fails
+    ThrowingCopy::copies_left = 2;
+    EXPECT_THROW(one.insert(one.begin() + 1, src.begin(), src.end()),
+                 std::runtime_error);
+    ASSERT_EQ(one.capacity(), 4);
+    ASSERT_EQ(ThrowingCopy::alive, 7);
+    for (int i = 0; i < 4; ++i) ASSERT_EQ(one[i].value, i);
+    // the second new element fails with the gap open in place
+    ThrowingCopy::copies_left = 100;
+    one.reserve(10);
+    ThrowingCopy::copies_left = 1;
+    EXPECT_THROW(one.insert(one.begin() + 1, src.begin(), src.end()),
+                 std::runtime_error);
+    ASSERT_EQ(one.size(), 4);
+    ASSERT_EQ(ThrowingCopy::alive, 7);
+    for (int i = 0; i < 4; ++i) ASSERT_EQ(one[i].value, i);
+    ThrowingCopy::copies_left = 100;
+    one.insert(one.begin() + 1, src.begin(), src.end());
+    std::vector<int> values;
+    for (const auto &item : one) values.push_back(item.value);
+    ASSERT_EQ(values, (std::vector<int>{0, 7, 8, 9, 1, 2, 3}));
+  }
+  ASSERT_EQ(ThrowingCopy::alive, 0);
+}
+
+TEST(VectorTest, 71) {
+  {
+    s21::vector<ThrowingCopy> one;
+    for (int i = 0; i < 4; ++i) one.emplace_back(i);
+    one.shrink_to_fit();
+    ThrowingCopy::copies_left = 2;
+    EXPECT_THROW(one.emplace(one.begin() + 1, 5), std::runtime_error);
+    ThrowingCopy::copies_left = 3;
+    EXPECT_THROW(one.emplace_back(6), std::runtime_error);
+    ASSERT_EQ(one.capacity(), 4);
+    ASSERT_EQ(ThrowingCopy::alive, 4);
+    for (int i = 0; i < 4; ++i) ASSERT_EQ(one[i].value, i);
+    ThrowingCopy::copies_left = 100;
+    one.emplace(one.begin() + 1, 5);
+    ASSERT_EQ(one.size(), 5);
+    ASSERT_EQ(one[1].value, 5);
+    ASSERT_EQ(one[4].value, 3);
+  }
+  ASSERT_EQ(ThrowingCopy::alive, 0);
+}
+
+TEST(VectorTest, 72) {
+  s21::vector<bool> one;
+  one.pop_back();
+  ASSERT_TRUE(one.empty());
+  one.push_back(true);
+  one.pop_back();
+  one.pop_back();
+  ASSERT_EQ(one.size(), 0);
+  one.push_back(false);
+  one.push_back(true);
+  ASSERT_EQ(one.size(), 2);
+  ASSERT_TRUE(one.back());
+  ASSERT_EQ(one.count(), 1);
+}
+
+// MoveOnlyThrowing cannot be copied, so relocation has to use its throwing
+// move. Each element owns a heap int, which a second destruction would free
+// twice
+struct MoveOnlyThrowing {
+  static inline int moves_left = 0;
+  std::unique_ptr<int> value;
+  MoveOnlyThrowing(int v = 0) : value(new int(v)) {}
+  MoveOnlyThrowing(MoveOnlyThrowing &&other) : value(new int(*other.value)) {
+    if (moves_left-- == 0) throw std::runtime_error("move failed");
+  }
+  MoveOnlyThrowing &operator=(MoveOnlyThrowing &&other) {
+    *value = *other.value;
+    return *this;
+  }
+};
+
+TEST(VectorTest, 73) {
+  s21::vector<MoveOnlyThrowing> one;
+  one.reserve(4);
+  for (int i = 0; i < 4; ++i) one.emplace_back(i);
+  MoveOnlyThrowing::moves_left = 2;
+  EXPECT_THROW(one.reserve(100), std::runtime_error);
+  ASSERT_EQ(one.capacity(), 4);
+  MoveOnlyThrowing::moves_left = 1;
+  EXPECT_THROW(one.emplace(one.begin() + 2, 9), std::runtime_error);
+  ASSERT_EQ(one.size(), 4);
+  for (int i = 0; i < 4; ++i) ASSERT_EQ(*one[i].value, i);
+  MoveOnlyThrowing::moves_left = 100;
+  one.emplace_back(4);
+  ASSERT_EQ(one.size(), 5);
+  for (int i = 0; i < 5; ++i) ASSERT_EQ(*one[i].value, i);
+}
+
 // leaks on mac
 
 // TEST(VectorTest, 2) {